@@ -0,0 +1,99 @@
+#!/bin/sh
+#
+# Run the headless unthrottled benchmark over a list of games and collect
+# one CSV and/or JSON row per game.
+#
+#   bench.sh [-e mame] [-s seconds] [-c out.csv] [-j out.jsonl] [-t limit] [-n] [game ...]
+#
+# Without game names every driver in the binary is run, so pointing -e at
+# a binary built with TARGET=neomame or TARGET=tiny benchmarks that whole
+# .mak target. Game names may use the same wildcards as -list.
+#
+# Each run is killed after -t seconds of wall time (default four times -s
+# plus a minute). A game that crashes or is killed gets a "crashed" or
+# "timeout" row written here, since the emulator can't write it itself.
+#
+
+EMU=./mame
+SECONDS_RUN=30
+CSV=bench.csv
+JSON=
+LIMIT=
+NOCLONES=
+
+while getopts "e:s:c:j:t:n" opt; do
+	case $opt in
+		e) EMU=$OPTARG ;;
+		s) SECONDS_RUN=$OPTARG ;;
+		c) CSV=$OPTARG ;;
+		j) JSON=$OPTARG ;;
+		t) LIMIT=$OPTARG ;;
+		n) NOCLONES=-noclones ;;
+		*) echo "usage: $0 [-e mame] [-s seconds] [-c out.csv] [-j out.jsonl] [-t limit] [-n] [game ...]"; exit 1 ;;
+	esac
+done
+shift $((OPTIND - 1))
+[ -z "$LIMIT" ] && LIMIT=$((SECONDS_RUN * 4 + 60))
+
+# the OS layer logs to stdout as well, keep only bare driver names
+listnames()
+{
+	$EMU "$@" -listnames -headless $NOCLONES | grep -E '^[a-z0-9_]+$'
+}
+
+if [ $# -eq 0 ]; then
+	GAMES=$(listnames)
+else
+	GAMES=
+	for g in "$@"; do
+		GAMES="$GAMES $(listnames $g)"
+	done
+fi
+
+OUT="-benchcsv $CSV"
+[ -n "$JSON" ] && OUT="$OUT -benchjson $JSON"
+
+# rows for game $1 so far, the header written before the run doesn't count
+rows()
+{
+	cat "$CSV" 2>/dev/null | grep -c "^$1,"
+}
+
+# row for a run that ended without writing one, zero for every number so
+# the columns line up with the emulator's header
+addrow()
+{
+	ncol=$(head -n 1 "$CSV" 2>/dev/null | awk -F, '{ print NF }')
+	[ -z "$ncol" ] && ncol=6
+	row="$1,$2,,0.000,0.000,0.00"
+	i=6
+	while [ $i -lt $ncol ]; do
+		row="$row,0.00"
+		i=$((i + 1))
+	done
+	echo "$row" >> "$CSV"
+	[ -n "$JSON" ] && echo "{\"game\":\"$1\",\"status\":\"$2\",\"cpu_types\":\"\",\"emulated_s\":0.000,\"wall_s\":0.000,\"speed\":0.00,\"profile\":{}}" >> "$JSON"
+}
+
+LOG=$(mktemp) || exit 1
+trap 'rm -f "$LOG"' EXIT
+
+for g in $GAMES; do
+	echo "=== $g"
+	before=$(rows $g)
+	timeout $LIMIT $EMU $g -headless -bench $SECONDS_RUN $OUT > "$LOG" 2>&1
+	rc=$?
+	grep '^bench:' "$LOG"
+	[ "$(rows $g)" -gt "$before" ] && continue
+	# no row: timeout exits 124 when it kills the run, 128+signal when the
+	# emulator itself died of one
+	if [ $rc -eq 124 ]; then
+		status=timeout
+	elif [ $rc -gt 128 ]; then
+		status=crashed
+	else
+		status=failed
+	fi
+	echo "bench: $g $status (exit $rc)"
+	addrow $g $status
+done
@@ -32,6 +32,9 @@ void showdisclaimer(void)   /* MAURY_BEGIN: dichiarazione */
 }                           /* MAURY_END: dichiarazione */
 
 
+unsigned int rom_crc_signature;
+
+
 /***************************************************************************
 
   Read ROMs into memory.
@@ -42,6 +45,73 @@ void showdisclaimer(void)   /* MAURY_BEGIN: dichiarazione */
 
 ***************************************************************************/
 
+/* locate a ROM, trying the parent sets and then its CRC as the name */
+static void *open_rom(const struct RomModule *romp)
+{
+	const struct GameDriver *drv;
+	void *f;
+
+	drv = Machine->gamedrv;
+	do
+	{
+		f = osd_fopen(drv->name,romp->name,OSD_FILETYPE_ROM,0);
+		drv = drv->clone_of;
+	} while (f == 0 && drv);
+
+	if (f == 0)
+	{
+		/* NS981003: support for "load by CRC" */
+		char crc[9];
+
+		sprintf(crc,"%08x",romp->crc);
+		drv = Machine->gamedrv;
+		do
+		{
+			f = osd_fopen(drv->name,crc,OSD_FILETYPE_ROM,0);
+			drv = drv->clone_of;
+		} while (f == 0 && drv);
+	}
+
+	return f;
+}
+
+/* a plain ROM_LOAD that fills its space exactly and that no other ROM of the */
+/* region overlaps can be read straight into the region */
+static int rom_loads_in_place(const struct RomModule *first,const struct RomModule *romp,void *f,unsigned int region_size)
+{
+	const struct RomModule *r;
+	unsigned int start = romp->offset;
+	unsigned int end = start + (romp->length & ~ROMFLAG_MASK);
+
+	if (romp->length & (ROMFLAG_ALTERNATE | ROMFLAG_NIBBLE | ROMFLAG_QUAD))
+		return 0;
+	if (romp[1].length && (romp[1].name == 0 || romp[1].name == (char *)-1))
+		return 0;	/* ROM_CONTINUE/ROM_RELOAD read it again */
+	if (end > region_size || osd_fsize(f) != end - start)
+		return 0;
+
+	for (r = first;r->length;r++)
+	{
+		unsigned int length = r->length & ~ROMFLAG_MASK;
+		unsigned int rstart = r->offset;
+		unsigned int rend = r->offset + length;
+
+		/* interleaved loads spread over more of the region */
+		if (r->length & ROMFLAG_QUAD)
+			rend = r->offset + 4 * length;
+		else if ((r->length & ROMFLAG_ALTERNATE) && !(r->length & ROMFLAG_NIBBLE))
+		{
+			rstart = r->offset & ~1;
+			rend = r->offset + 2 * length;
+		}
+
+		if (r != romp && rstart < end && rend > start)
+			return 0;
+	}
+	return 1;
+}
+
+
 int readroms(void)
 {
 	int region;
@@ -50,9 +120,13 @@ int readroms(void)
 	int fatalerror = 0;
 	int total_roms,current_rom;
 	char buf[4096] = "";
+	void **files = 0;
+	unsigned char **dest = 0;
+	int total_files = 0,current_file = 0;
 
 
 	total_roms = current_rom = 0;
+	rom_crc_signature = 0;
 	romp = Machine->gamedrv->rom;
 
 	if (!romp) return 0;
@@ -69,7 +143,10 @@ int readroms(void)
 	romp = Machine->gamedrv->rom;
 
 	for (region = 0;region < MAX_MEMORY_REGIONS;region++)
+	{
 		Machine->memory_region[region] = 0;
+		Machine->memory_region_mapped[region] = 0;
+	}
 
 	region = 0;
 
@@ -112,6 +189,64 @@ int readroms(void)
 
 		romp++;
 
+		/* open all of the region's ROMs now and read them concurrently; */
+		/* the loop below then only has to put them in place */
+		{
+			const struct RomModule *r;
+
+			total_files = current_file = 0;
+			for (r = romp;r->length;r++)
+				if (r->name && r->name != (char *)-1)
+					total_files++;
+
+			free(files);
+			free(dest);
+			files = (void **) malloc((total_files + 1) * sizeof(void *));
+			dest = (unsigned char **) malloc((total_files + 1) * sizeof(unsigned char *));
+			if (!files || !dest)
+			{
+				printf("readroms():  Unable to allocate ROM list\n");
+				total_files = 0;
+				goto getout;
+			}
+
+			for (r = romp;r->length;r++)
+				if (r->name && r->name != (char *)-1)
+					files[current_file++] = open_rom(r);
+
+			/* a region that is only read and is exactly one ROM file can */
+			/* just use the file's pages */
+			if ((Machine->memory_region_type[region] & (REGIONFLAG_DISPOSE | REGIONFLAG_READONLY)) &&
+					total_files == 1 && files[0] && romp->name && romp->name != (char *)-1 &&
+					romp->offset == 0 && (romp->length & ~ROMFLAG_MASK) == region_size &&
+					rom_loads_in_place(romp,romp,files[0],region_size))
+			{
+				unsigned char *map = (unsigned char *) osd_fmap(files[0]);
+
+				if (map)
+				{
+					free(Machine->memory_region[region]);
+					Machine->memory_region[region] = map;
+					Machine->memory_region_mapped[region] = 1;
+				}
+			}
+
+			current_file = 0;
+			for (r = romp;r->length;r++)
+			{
+				if (r->name && r->name != (char *)-1)
+				{
+					dest[current_file] = 0;
+					if (files[current_file] && !Machine->memory_region_mapped[region] &&
+							rom_loads_in_place(romp,r,files[current_file],region_size))
+						dest[current_file] = Machine->memory_region[region] + r->offset;
+					current_file++;
+				}
+			}
+			osd_fload(files,dest,total_files);
+			current_file = 0;
+		}
+
 		while (romp->length)
 		{
 			void *f;
@@ -136,30 +271,9 @@ int readroms(void)
 			if (osd_display_loading_rom_message(name,++current_rom,total_roms) != 0)
                goto getout;
 
-			{
-				const struct GameDriver *drv;
-
-				drv = Machine->gamedrv;
-				do
-				{
-					f = osd_fopen(drv->name,name,OSD_FILETYPE_ROM,0);
-					drv = drv->clone_of;
-				} while (f == 0 && drv);
-
-				if (f == 0)
-				{
-					/* NS981003: support for "load by CRC" */
-					char crc[9];
-
-					sprintf(crc,"%08x",romp->crc);
-					drv = Machine->gamedrv;
-					do
-					{
-						f = osd_fopen(drv->name,crc,OSD_FILETYPE_ROM,0);
-						drv = drv->clone_of;
-					} while (f == 0 && drv);
-				}
-			}
+			/* opened (and most likely read) before the region's first ROM */
+			f = files[current_file];
+			files[current_file++] = 0;
 
 			if (f)
 			{
@@ -318,6 +432,9 @@ int readroms(void)
 								name,expchecksum,osd_fcrc(f));
 				}
 
+				/* fold in the CRC actually found, so caches keyed on it notice swapped ROMs */
+				rom_crc_signature = ((rom_crc_signature << 1) | (rom_crc_signature >> 31)) ^ osd_fcrc(f);
+
 				osd_fclose(f);
 			}
 			else if (romp->length & ROMFLAG_OPTIONAL)
@@ -374,6 +491,9 @@ int readroms(void)
 		region++;
 	}
 
+	free(files);
+	free(dest);
+
 	/* final status display */
 	osd_display_loading_rom_message(0,current_rom,total_roms);
 
@@ -404,13 +524,22 @@ int readroms(void)
 
 
 getout:
+	/* close whatever the region being loaded hadn't got to yet */
+	while (current_file < total_files)
+	{
+		if (files[current_file])
+			osd_fclose(files[current_file]);
+		current_file++;
+	}
+	free(files);
+	free(dest);
+
 	/* final status display */
 	osd_display_loading_rom_message(0,current_rom,total_roms);
 
 	for (region = 0;region < MAX_MEMORY_REGIONS;region++)
 	{
-		free(Machine->memory_region[region]);
-		Machine->memory_region[region] = 0;
+		release_memory_region(region);
 	}
 
 	return 1;
@@ -699,6 +828,7 @@ int new_memory_region(int num, int length)
     if (num < MAX_MEMORY_REGIONS)
     {
         Machine->memory_region_length[num] = length;
+        Machine->memory_region_mapped[num] = 0;
         Machine->memory_region[num] = (unsigned char*) malloc(length);
         return (Machine->memory_region[num] == NULL) ? 1 : 0;
     }
@@ -710,6 +840,7 @@ int new_memory_region(int num, int length)
             {
                 Machine->memory_region_length[i] = length;
                 Machine->memory_region_type[i] = num;
+                Machine->memory_region_mapped[i] = 0;
                 Machine->memory_region[i] = (unsigned char*) malloc(length);
                 return (Machine->memory_region[i] == NULL) ? 1 : 0;
             }
@@ -723,24 +854,30 @@ void free_memory_region(int num)
 	int i;
 
 	if (num < MAX_MEMORY_REGIONS)
-	{
-		free(Machine->memory_region[num]);
-		Machine->memory_region[num] = 0;
-	}
+		release_memory_region(num);
 	else
 	{
 		for (i = 0;i < MAX_MEMORY_REGIONS;i++)
 		{
 			if ((Machine->memory_region_type[i] & ~REGIONFLAG_MASK) == num)
 			{
-				free(Machine->memory_region[i]);
-				Machine->memory_region[i] = 0;
+				release_memory_region(i);
 				return;
 			}
 		}
 	}
 }
 
+void release_memory_region(int num)
+{
+	if (Machine->memory_region_mapped[num])
+		osd_funmap(Machine->memory_region[num],Machine->memory_region_length[num]);
+	else
+		free(Machine->memory_region[num]);
+	Machine->memory_region[num] = 0;
+	Machine->memory_region_mapped[num] = 0;
+}
+
 
 /* LBO 042898 - added coin counters */
 WRITE_HANDLER( coin_counter_w )
@@ -79,6 +79,7 @@ enum {
 #define REGIONFLAG_MASK			0xf8000000
 #define REGIONFLAG_DISPOSE		0x80000000           /* Dispose of this region when done */
 #define REGIONFLAG_SOUNDONLY	0x40000000           /* load only if sound emulation is turned on */
+#define REGIONFLAG_READONLY		0x20000000           /* never written, so it may be mapped from the ROM file */
 
 
 #define BADCRC( crc ) (~(crc))
@@ -170,6 +171,7 @@ WRITE_HANDLER( coin_lockout_global_w );  /* Locks out all coin inputs */
 
 
 int readroms(void);
+extern unsigned int rom_crc_signature;	/* combined CRC of every ROM readroms() loaded */
 void printromlist(const struct RomModule *romp,const char *name);
 
 /* helper function that reads samples from disk - this can be used by other */
@@ -185,6 +187,7 @@ int memory_region_length(int num);
 /* number, or one of the REGION_XXX identifiers defined above */
 int new_memory_region(int num, int length);
 void free_memory_region(int num);
+void release_memory_region(int num);	/* free slot num, be it malloc()ed or mapped */
 
 extern data_t flip_screen_x, flip_screen_y;
 
@@ -153,11 +153,14 @@ struct cpuinfo
 	timer_tm timedint_period; 		/* timing period of the timed interrupt */
 	void *context;					/* dynamically allocated context buffer */
 	int save_context;				/* need to context switch this CPU? yes or no */
+	int deferred;					/* takes latches and interrupts through the journal */
 } __attribute__ ((__aligned__ (32)));
 
 static struct cpuinfo cpu[MAX_CPU];
 
 static int activecpu,totalcpu;
+static int latch_cpu;		/* deferred CPU that reads the sound latches, -1 if none */
+int cpu_defer_audio = 0;	/* -deferaudio: treat every audio CPU as CPU_DEFERRED */
 static int cycles_running;	/* number of cycles that the CPU emulation was requested to run */
 					/* (needed by cpu_getfcount) */
 static int have_to_reset;
@@ -183,6 +186,48 @@ static timer_tm timeslice_period;
 
 static timer_tm scanline_period;
 
+/* automatic idle loop skipping (-idleskip) */
+#define IDLE_WINDOW		16		/* bytes of code a polling loop may span */
+#define IDLE_CONFIRM	60		/* interrupts in a row that must land in it */
+#define IDLE_PROBES		8		/* idle checks per frame */
+
+int idle_skip = 0;
+int idle_reset = 0;				/* -idlereset: forget the game's .idl */
+static int idle_off;			/* "off" in the game's .idl file */
+static void *idle_probe_timer;
+
+static struct
+{
+	unsigned lo, hi, sp;		/* the loop, or the candidate so far */
+	int count;					/* interrupts that landed in the candidate */
+	int saved;					/* a loop read from the .idl, not checked yet */
+	unsigned saved_pc, saved_sp;
+	unsigned rejected;			/* last candidate that wasn't a branch to self, +1 */
+	int found;					/* confirmed, skip it */
+	int ints;					/* interrupts delivered, see idle_check() */
+	int armed, armed_ints;		/* in the loop at the last check, and ints then */
+	int asleep;					/* suspended by us until the next interrupt */
+} idle[MAX_CPU];
+
+/* scheduling statistics (-cpustats) and slice auto-tuning (-autoslice) */
+#define SLICE_QUIET		30		/* frames without a resync before the slices double */
+
+int cpu_stats = 0;
+int cpu_autoslice = 0;
+
+static struct
+{
+	int slices;					/* times the CPU was scheduled */
+	int sleeps;					/* slices that ended with the CPU suspended */
+	INT64 cycles;				/* cycles run, as returned by the core */
+	INT64 lost;					/* of those, cut off by timers set mid-slice */
+} stats[MAX_CPU];
+static int stats_frames, stats_coarse, stats_syncs;
+
+static int slice_shift;			/* timeslices are timeslice_period << slice_shift */
+static int slice_quiet;			/* frames since the last resync */
+static int slice_syncs;			/* timer_sync_count() when we last looked */
+
 static int usres; /* removed from cpu_run and made global */
 static int vblank;
 static int current_frame;
@@ -274,6 +319,7 @@ static unsigned Dummy_dasm(char *buffer, unsigned pc);
 
 #define CPU_TYPE(index) 				(Machine->drv->cpu[index].cpu_type & ~CPU_FLAGS_MASK)
 #define CPU_AUDIO(index)				(Machine->drv->cpu[index].cpu_type & CPU_AUDIO_CPU)
+#define CPU_DEFERRED_FLAG(index)		((Machine->drv->cpu[index].cpu_type & CPU_DEFERRED) || (cpu_defer_audio && CPU_AUDIO(index)))
 
 #define IFC_INFO(cpu,context,regnum)	((cpuintf[cpu].cpu_info)(context,regnum))
 
@@ -584,15 +630,383 @@ logerror("CPU #%d [%s] wrong ID %d: check enum CPU_... in src/driver.h!\n", i, c
 	timeslice_timer = refresh_timer = vblank_timer = NULL;
 }
 
+/***************************************************************************
+
+  Idle loop detection. A CPU that is found on the same instruction with
+  the same stack pointer every time its periodic interrupt arrives, and
+  that instruction is a branch to itself, can only be waiting for that
+  interrupt, so the CPU is put to sleep with cpu_spinuntil_int() whenever
+  a slice ends on it. Loops that poll memory are left alone: another CPU
+  can write what they poll without interrupting them. The loops are kept
+  in cfg/<game>.idl, one "cpu lo hi sp" per line, and are checked again
+  the first time the CPU is seen there on the next run; a line saying
+  "off" disables skipping for that game, and -idlereset starts it afresh.
+
+***************************************************************************/
+static void idle_load(void)
+{
+	char line[64];
+	unsigned lo, hi, sp;
+	void *f;
+	int n;
+
+	memset(idle, 0, sizeof(idle));
+	idle_off = 0;
+	if (!idle_skip) return;
+
+	if (idle_reset)
+	{
+		if ((f = osd_fopen(Machine->gamedrv->name, 0, OSD_FILETYPE_IDLE, 1)) != 0)
+			osd_fclose(f);
+		logerror("idle loops of %s forgotten\n", Machine->gamedrv->name);
+		return;
+	}
+
+	if ((f = osd_fopen(Machine->gamedrv->name, 0, OSD_FILETYPE_IDLE, 0)) == 0)
+		return;
+	while (osd_fgets(line, sizeof(line), f))
+	{
+		if (!strncmp(line, "off", 3))
+			idle_off = 1;
+		else if (sscanf(line, "%d %x %x %x", &n, &lo, &hi, &sp) == 4 && n >= 0 && n < totalcpu)
+		{
+			/* only branches to self are written, anything else is stale */
+			if (lo == hi)
+			{
+				idle[n].saved_pc = lo;
+				idle[n].saved_sp = sp;
+				idle[n].saved = 1;
+			}
+		}
+	}
+	osd_fclose(f);
+	if (idle_off)
+		logerror("idle loop skipping disabled for %s\n", Machine->gamedrv->name);
+}
+
+static void idle_save(void)
+{
+	char line[64];
+	void *f;
+	int i;
+
+	if ((f = osd_fopen(Machine->gamedrv->name, 0, OSD_FILETYPE_IDLE, 1)) == 0)
+		return;
+	for (i = 0; i < totalcpu; i++)
+		if (idle[i].found)
+		{
+			sprintf(line, "%d %x %x %x\n", i, idle[i].lo, idle[i].hi, idle[i].sp);
+			osd_fwrite(f, line, strlen(line));
+		}
+		else if (idle[i].saved)
+		{
+			sprintf(line, "%d %x %x %x\n", i, idle[i].saved_pc, idle[i].saved_pc, idle[i].saved_sp);
+			osd_fwrite(f, line, strlen(line));
+		}
+	osd_fclose(f);
+}
+
+/* does nothing, it only ends the running slice so idle_check() gets a look */
+static void idle_probe(int param)
+{
+}
+
+static void idle_start_probe(void)
+{
+	if (!idle_probe_timer)
+		idle_probe_timer = timer_pulse(TIME_IN_HZ(Machine->drv->frames_per_second * IDLE_PROBES), 0, idle_probe);
+}
+
+/*
+ * Is the instruction at pc a jump or branch to itself? A conditional one
+ * counts: nothing but an interrupt can change the flags it tests. Only
+ * the families whose encodings are listed here are ever skipped.
+ */
+static int idle_branch_to_self(int cpunum, unsigned pc)
+{
+	unsigned op;
+
+	SET_OP_BASE(cpunum, pc);
+	switch (CPU_TYPE(cpunum))
+	{
+#if (HAS_Z80)
+		case CPU_Z80:
+#endif
+#if (HAS_DRZ80)
+		case CPU_DRZ80:
+#endif
+#if (HAS_Z80GB)
+		case CPU_Z80GB:
+#endif
+			op = cpu_readop(pc);
+			/* jr $ / jr cc,$ */
+			if ((op == 0x18 || (op & 0xe7) == 0x20) && cpu_readop_arg((pc + 1) & 0xffff) == 0xfe)
+				return 1;
+			/* jp $ / jp cc,$ */
+			if ((op == 0xc3 || (op & 0xc7) == 0xc2) &&
+					(cpu_readop_arg((pc + 1) & 0xffff) | (cpu_readop_arg((pc + 2) & 0xffff) << 8)) == pc)
+				return 1;
+			return 0;
+
+#if (HAS_M6502)
+		case CPU_M6502:
+#endif
+#if (HAS_M65C02)
+		case CPU_M65C02:
+#endif
+#if (HAS_M65SC02)
+		case CPU_M65SC02:
+#endif
+#if (HAS_M6510)
+		case CPU_M6510:
+#endif
+#if (HAS_M6510T)
+		case CPU_M6510T:
+#endif
+#if (HAS_N2A03)
+		case CPU_N2A03:
+#endif
+			op = cpu_readop(pc);
+			/* bcc * */
+			if ((op & 0x1f) == 0x10 && cpu_readop_arg((pc + 1) & 0xffff) == 0xfe)
+				return 1;
+			/* jmp * */
+			if (op == 0x4c && (cpu_readop_arg((pc + 1) & 0xffff) | (cpu_readop_arg((pc + 2) & 0xffff) << 8)) == pc)
+				return 1;
+			return 0;
+
+#if (HAS_M6800)
+		case CPU_M6800:
+#endif
+#if (HAS_M6801)
+		case CPU_M6801:
+#endif
+#if (HAS_M6802)
+		case CPU_M6802:
+#endif
+#if (HAS_M6803)
+		case CPU_M6803:
+#endif
+#if (HAS_M6808)
+		case CPU_M6808:
+#endif
+#if (HAS_HD63701)
+		case CPU_HD63701:
+#endif
+#if (HAS_M6809)
+		case CPU_M6809:
+#endif
+#if (HAS_HD6309)
+		case CPU_HD6309:
+#endif
+			op = cpu_readop(pc);
+			/* bra * / bcc *, not brn */
+			if ((op & 0xf0) == 0x20 && op != 0x21 && cpu_readop_arg((pc + 1) & 0xffff) == 0xfe)
+				return 1;
+			/* jmp * */
+			if (op == 0x7e && ((cpu_readop_arg((pc + 1) & 0xffff) << 8) | cpu_readop_arg((pc + 2) & 0xffff)) == pc)
+				return 1;
+			return 0;
+
+#if (HAS_M68000)
+		case CPU_M68000:
+#endif
+#if (HAS_CYCLONE)
+		case CPU_CYCLONE:
+#endif
+#if (HAS_FAME)
+		case CPU_FAME:
+#endif
+#if (HAS_M68010)
+		case CPU_M68010:
+#endif
+			pc &= 0xffffff;
+			/* fall through */
+#if (HAS_M68EC020)
+		case CPU_M68EC020:
+#endif
+#if (HAS_M68020)
+		case CPU_M68020:
+#endif
+			op = cpu_readop16(pc);
+			/* bra.s * / bcc.s *, not bsr */
+			if ((op & 0xf0ff) == 0x60fe && op != 0x61fe)
+				return 1;
+			/* bra.w * / bcc.w * */
+			if ((op & 0xf0ff) == 0x6000 && op != 0x6100 && cpu_readop_arg16(pc + 2) == 0xfffe)
+				return 1;
+			/* jmp (xxx).l */
+			if (op == 0x4ef9 && ((cpu_readop_arg16(pc + 2) << 16) | cpu_readop_arg16(pc + 4)) == pc)
+				return 1;
+			return 0;
+	}
+	return 0;
+}
+
+/* called with the CPU's context swapped in, before a periodic interrupt */
+static void idle_sample(int cpunum)
+{
+	unsigned pc, sp, lo, hi;
+
+	if (!idle_skip || idle_off || idle[cpunum].found) return;
+
+	pc = GETPC(cpunum);
+	sp = GETSP(cpunum);
+
+	/* a loop from the .idl: check it once the CPU is there */
+	if (idle[cpunum].saved && pc == idle[cpunum].saved_pc && sp == idle[cpunum].saved_sp)
+	{
+		idle[cpunum].saved = 0;
+		if (idle_branch_to_self(cpunum, pc))
+		{
+			idle[cpunum].lo = idle[cpunum].hi = pc;
+			idle[cpunum].sp = sp;
+			idle[cpunum].found = 1;
+			idle_start_probe();
+		}
+		else
+		{
+			logerror("CPU #%d saved idle loop at %x is not a branch to itself, dropped\n", cpunum, pc);
+			idle_save();
+		}
+		return;
+	}
+
+	lo = pc < idle[cpunum].lo ? pc : idle[cpunum].lo;
+	hi = pc > idle[cpunum].hi ? pc : idle[cpunum].hi;
+	if (idle[cpunum].count == 0 || sp != idle[cpunum].sp || hi - lo >= IDLE_WINDOW)
+	{
+		idle[cpunum].lo = idle[cpunum].hi = pc;
+		idle[cpunum].sp = sp;
+		idle[cpunum].count = 1;
+		return;
+	}
+	idle[cpunum].lo = lo;
+	idle[cpunum].hi = hi;
+	if (++idle[cpunum].count < IDLE_CONFIRM) return;
+
+	/* a loop over several instructions polls something, which another */
+	/* CPU may write without interrupting it; only skip a branch to self */
+	if (lo != hi || !idle_branch_to_self(cpunum, lo))
+	{
+		if (idle[cpunum].rejected != lo + 1)
+			logerror("CPU #%d waits at %x-%x sp %x, not a branch to itself, not skipped\n", cpunum, lo, hi, sp);
+		idle[cpunum].rejected = lo + 1;
+		idle[cpunum].count = 0;
+		return;
+	}
+
+	idle[cpunum].found = 1;
+	idle[cpunum].saved = 0;
+	logerror("CPU #%d idle loop at %x sp %x\n", cpunum, lo, sp);
+	idle_save();
+	idle_start_probe();
+}
+
+/* an interrupt reached the CPU, whatever it was polling may have changed */
+static void idle_interrupt(int cpunum)
+{
+	idle[cpunum].ints++;
+	idle[cpunum].asleep = 0;
+}
+
+/*
+ * Called after a slice. Being inside the loop once proves nothing, the
+ * interrupt may have just released it; only sleep if the CPU is still there
+ * at the next check and no interrupt came in between.
+ */
+static void idle_check(int cpunum, unsigned pc, unsigned sp)
+{
+	if (pc < idle[cpunum].lo || pc > idle[cpunum].hi || sp != idle[cpunum].sp)
+	{
+		idle[cpunum].armed = 0;
+		return;
+	}
+	if (idle[cpunum].armed && idle[cpunum].armed_ints == idle[cpunum].ints)
+	{
+		idle[cpunum].armed = 0;
+		idle[cpunum].asleep = 1;
+		timer_suspendcpu_trigger(cpunum, TRIGGER_INT + cpunum);
+		return;
+	}
+	idle[cpunum].armed = 1;
+	idle[cpunum].armed_ints = idle[cpunum].ints;
+}
+
+/***************************************************************************
+
+  Slice auto-tuning. The driver's cpu_slices_per_frame is what it needs
+  while the CPUs talk to each other; while none of them asks for a resync
+  (a TIME_NOW timer or a trigger, which is how latches, cross-CPU
+  interrupts and handshakes reach the scheduler) the slices are doubled
+  every SLICE_QUIET frames, up to one per frame. The first resync drops
+  them back to the driver's size at once. Shared RAM that is just mapped
+  into both CPUs goes unseen, so this is opt-in and -cpustats tells
+  whether a game is worth trying.
+
+***************************************************************************/
+static void slice_set(int shift)
+{
+	slice_shift = shift;
+	timer_remove(timeslice_timer);
+	timeslice_timer = timer_pulse(timeslice_period << shift, 0, cpu_timeslicecallback);
+}
+
+static void slice_frame(void)
+{
+	int syncs = timer_sync_count();
+
+	if (slice_shift) stats_coarse++;
+	if (syncs != slice_syncs)
+	{
+		slice_syncs = syncs;
+		slice_quiet = 0;
+		return;
+	}
+	if (++slice_quiet < SLICE_QUIET) return;
+	slice_quiet = 0;
+	if ((timeslice_period << (slice_shift + 1)) <= refresh_period)
+		slice_set(slice_shift + 1);
+}
+
+static void stats_report(void)
+{
+	int frames = stats_frames ? stats_frames : 1;
+	int i;
+
+	printf("%d frames, %.2f resyncs/frame", stats_frames, (float)(timer_sync_count() - stats_syncs) / frames);
+	if (cpu_autoslice)
+		printf(", %d%% with coarse slices", stats_coarse * 100 / frames);
+	printf("\n");
+	for (i = 0; i < totalcpu; i++)
+	{
+		int slices = stats[i].slices ? stats[i].slices : 1;
+
+		printf("CPU #%d %-10s %7.1f slices/frame %8d cycles/slice %5.1f%% lost %5.1f%% asleep\n",
+				i, cputype_name(CPU_TYPE(i)), (float)stats[i].slices / frames,
+				(int)(stats[i].cycles / slices),
+				stats[i].cycles ? (float)stats[i].lost * 100 / stats[i].cycles : 0.0f,
+				(float)stats[i].sleeps * 100 / slices);
+		logerror("CPU #%d: %d slices %d sleeps %d cycles %d lost in %d frames\n", i,
+				stats[i].slices, stats[i].sleeps, (int)stats[i].cycles, (int)stats[i].lost, stats_frames);
+	}
+}
+
 void cpu_run(void)
 {
 	int i;
 
 	/* determine which CPUs need a context switch */
+	latch_cpu = -1;
 	for (i = 0; i < totalcpu; i++)
 	{
 		int j, size;
 
+		/* the first deferred CPU gets the sound latches */
+		cpu[i].deferred = CPU_DEFERRED_FLAG(i) ? 1 : 0;
+		if (cpu[i].deferred && latch_cpu < 0)
+			latch_cpu = i;
+
 		/* allocate a context buffer for the CPU */
 		size = GETCONTEXT(i,NULL);
 		if( size == 0 )
@@ -628,6 +1042,11 @@ logerror("CPU #%d failed to allocate context buffer (%d bytes)!\n", i, size);
 		}
 	}
 
+	idle_load();
+	memset(stats, 0, sizeof(stats));
+	stats_frames = stats_coarse = 0;
+	stats_syncs = timer_sync_count();
+
 reset:
 	/* read hi scores information from hiscore.dat */
 	hs_open(Machine->gamedrv->name);
@@ -637,6 +1056,19 @@ reset:
 	cpu_inittimers();
 	watchdog_counter = -1;
 
+	/* back to the driver's slices */
+	slice_shift = slice_quiet = 0;
+	slice_syncs = timer_sync_count();
+
+	/* timer_init() threw the probe away */
+	idle_probe_timer = NULL;
+	for (i = 0; i < totalcpu; i++)
+	{
+		idle[i].armed = idle[i].asleep = 0;
+		if (idle[i].found && !idle_off)
+			idle_start_probe();
+	}
+
 	/* reset sound chips */
 	sound_reset();
 
@@ -758,7 +1190,8 @@ logerror("Machine reset\n");
 		/* ask the timer system to schedule */
 		if (timer_schedule_cpu(&cpunum, &cycles_running))
 		{
-			int ran;
+			int ran, lost, idle_check_pc = 0;
+			unsigned pc = 0, sp = 0;
 
 
 			/* switch memory and CPU contexts */
@@ -777,12 +1210,40 @@ logerror("Machine reset\n");
 			/* update based on how many cycles we really ran */
 			cpu[activecpu].totalcycles += ran;
 
+			/* note where it stopped if it has an idle loop */
+			if (idle[cpunum].found && !idle_off)
+			{
+				idle_check_pc = 1;
+				pc = GETPC(activecpu);
+				sp = GETSP(activecpu);
+			}
+
 			/* update the contexts */
 			if (cpu[activecpu].save_context) GETCONTEXT(activecpu, cpu[activecpu].context);
 			activecpu = -1;
 
 			/* update the timer with how long we actually ran */
-			timer_update_cpu(cpunum, ran);
+			lost = timer_update_cpu(cpunum, ran);
+
+			if (idle_check_pc)
+				idle_check(cpunum, pc, sp);
+
+			if (cpu_stats)
+			{
+				stats[cpunum].slices++;
+				stats[cpunum].cycles += ran;
+				stats[cpunum].lost += lost;
+				if (timer_iscpususpended(cpunum, SUSPEND_ANY_REASON))
+					stats[cpunum].sleeps++;
+			}
+
+			/* someone talked, give the driver its interleave back */
+			if (slice_shift && timer_sync_count() != slice_syncs)
+			{
+				slice_syncs = timer_sync_count();
+				slice_quiet = 0;
+				slice_set(0);
+			}
 		}
 
 		profiler_mark(PROFILER_END);
@@ -791,6 +1252,9 @@ logerror("Machine reset\n");
 	/* write hi scores to disk - No scores saving if cheat */
 	hs_close();
 
+	if (cpu_stats)
+		stats_report();
+
 #ifdef MESS
 	if (Machine->drv->stop_machine) (*Machine->drv->stop_machine)();
 #endif
@@ -1240,7 +1704,8 @@ void cpu_set_irq_line(int cpunum, int irqline, int state)
 	if (cpu_getstatus(cpunum) == 0) return;
 
 	LOG(("cpu_set_irq_line(%d,%d,%d)\n",cpunum,irqline,state));
-	timer_set(TIME_NOW, (irqline & 7) | ((cpunum & 7) << 3) | (state << 6), cpu_manualirqcallback);
+	if (!cpu_defer(cpunum, cpu_manualirqcallback, (irqline & 7) | ((cpunum & 7) << 3) | (state << 6)))
+		timer_set(TIME_NOW, (irqline & 7) | ((cpunum & 7) << 3) | (state << 6), cpu_manualirqcallback);
 }
 
 /***************************************************************************
@@ -1254,14 +1719,39 @@ void cpu_cause_interrupt(int cpunum,int type)
 	/* don't trigger interrupts on suspended CPUs */
 	if (cpu_getstatus(cpunum) == 0) return;
 
-	timer_set(TIME_NOW, (cpunum & 7) | (type << 3), cpu_manualintcallback);
+	if (!cpu_defer(cpunum, cpu_manualintcallback, (cpunum & 7) | (type << 3)))
+		timer_set(TIME_NOW, (cpunum & 7) | (type << 3), cpu_manualintcallback);
 }
 
 
 
 void cpu_clear_pending_interrupts(int cpunum)
 {
-	timer_set(TIME_NOW, cpunum, cpu_clearintcallback);
+	if (!cpu_defer(cpunum, cpu_clearintcallback, cpunum))
+		timer_set(TIME_NOW, cpunum, cpu_clearintcallback);
+}
+
+
+
+/***************************************************************************
+
+  Events sent by another CPU to a deferred CPU (CPU_DEFERRED, or any audio
+  CPU with -deferaudio) are journaled with their time instead of stopping
+  the sender with a TIME_NOW timer. The deferred CPU runs up to that time
+  on its next slice and gets the event there, so the main CPU isn't cut
+  into pieces every time it sends a sound command. Only safe when the
+  deferred CPU never answers back within the same timeslice, which is why
+  drivers have to ask for it. cpunum -1 means the CPU that reads the sound
+  latches. Returns 0 if the caller must use timer_set(TIME_NOW, ...).
+
+***************************************************************************/
+int cpu_defer(int cpunum,void (*callback)(int),int param)
+{
+	if (cpunum < 0)
+		cpunum = latch_cpu;
+	if (cpunum < 0 || !cpu[cpunum].deferred || activecpu < 0 || activecpu == cpunum)
+		return 0;
+	return timer_defer(cpunum, callback, param);
 }
 
 
@@ -1513,7 +2003,10 @@ static void cpu_manualnmicallback(int param)
 
 	/* generate a trigger to unsuspend any CPUs waiting on the interrupt */
 	if (state != CLEAR_LINE)
+	{
+		idle_interrupt(cpunum);
 		timer_trigger(TRIGGER_INT + cpunum);
+	}
 }
 
 static void cpu_manualirqcallback(int param)
@@ -1557,7 +2050,10 @@ static void cpu_manualirqcallback(int param)
 
 	/* generate a trigger to unsuspend any CPUs waiting on the interrupt */
 	if (state != CLEAR_LINE)
+	{
+		idle_interrupt(cpunum);
 		timer_trigger(TRIGGER_INT + cpunum);
+	}
 }
 
 static void cpu_internal_interrupt(int cpunum, int type)
@@ -1577,6 +2073,7 @@ static void cpu_internal_interrupt(int cpunum, int type)
 	if (activecpu >= 0) memorycontextswap(activecpu);
 
 	/* generate a trigger to unsuspend any CPUs waiting on the interrupt */
+	idle_interrupt(cpunum);
 	timer_trigger(TRIGGER_INT + cpunum);
 }
 
@@ -1603,7 +2100,11 @@ static void cpu_generate_interrupt(int cpunum, int (*func)(void), int num)
 	if (cpu[activecpu].save_context) SETCONTEXT(activecpu, cpu[activecpu].context);
 
 	/* cause the interrupt, calling the function if it exists */
-	if (func) num = (*func)();
+	if (func)
+	{
+		idle_sample(cpunum);
+		num = (*func)();
+	}
 
 	/* wrapper for the new interrupt system */
 	if (num != INT_TYPE_NONE(cpunum))
@@ -1801,6 +2302,13 @@ static void cpu_generate_interrupt(int cpunum, int (*func)(void), int num)
 	if (activecpu >= 0) memorycontextswap(activecpu);
 
 	/* trigger already generated by cpu_manualirqcallback or cpu_manualnmicallback */
+
+	/* if the interrupt was masked, don't leave a CPU we put to sleep waiting for it */
+	if (func && idle[cpunum].asleep)
+	{
+		idle[cpunum].asleep = 0;
+		timer_suspendcpu(cpunum, 0, SUSPEND_REASON_TRIGGER);
+	}
 }
 
 static void cpu_clear_interrupts(int cpunum)
@@ -2044,6 +2552,9 @@ logerror("reset caused by the watchdog\n");
 	}
 
 	current_frame++;
+	stats_frames++;
+	if (cpu_autoslice)
+		slice_frame();
 
 	/* reset the refresh timer */
 	timer_reset(refresh_timer, TIME_NEVER);
@@ -441,6 +441,10 @@ WRITE_HANDLER( cpu_7_irq_line_vector_w );
 /* cause an interrupt on a CPU */
 void cpu_cause_interrupt(int cpu,int type);
 void cpu_clear_pending_interrupts(int cpu);
+
+/* queue an event for a deferred CPU (-1 = the sound latch reader) instead of
+   resynchronizing; returns 0 if timer_set(TIME_NOW,...) is still needed */
+int cpu_defer(int cpunum,void (*callback)(int),int param);
 WRITE_HANDLER( interrupt_enable_w );
 WRITE_HANDLER( interrupt_vector_w );
 int interrupt(void);
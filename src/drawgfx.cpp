@@ -57,7 +57,9 @@ INLINE int readbit(const UINT8 *src,int bitnum)
 }
 
 
-void decodechar(struct GfxElement *gfx,int num,const UINT8 *src,const struct GfxLayout *gl)
+/* reference decoder, one readbit() per pixel per plane. Only used when there */
+/* is no memory for a decode table. */
+static void decodechar_bits(struct GfxElement *gfx,int num,const UINT8 *src,const struct GfxLayout *gl)
 {
 	int plane,x,y;
 	UINT8 *dp;
@@ -126,10 +128,288 @@ void decodechar(struct GfxElement *gfx,int num,const UINT8 *src,const struct Gfx
 }
 
 
+/*
+  Table driven decoder. The layout, orientation and PREROTATE_GFX flips are
+  folded once into the bit offset of every plane of every output pixel, so
+  decoding a char is just gathering bits. Where 8 neighbouring pixels come
+  from one whole byte in every plane (the usual packed layouts), the byte is
+  spread to 8 pixels with a lookup instead.
+*/
+#define GATHER_BITS	0	/* pixel by pixel */
+#define GATHER_MSB	1	/* pixel i is bit 7-i of one byte per plane */
+#define GATHER_LSB	2	/* pixel i is bit i (FLIP_X prerotated) */
+
+struct gfx_decode_table
+{
+	struct GfxLayout gl;	/* what the table was built for */
+	int orientation;
+	int width,height;
+	int aligned;		/* charincrement is whole bytes, so byte offsets are per char constant */
+	int groups;		/* 8 pixel groups per line */
+	UINT32 *bitoffs;	/* [y][x][plane] bit offset from the start of the char */
+	UINT8 *gather;		/* [y][group] GATHER_* */
+	unsigned used;		/* decode_table_clock at the last lookup */
+	unsigned serial;	/* changes on every rebuild, so a GfxElement's cached pointer goes stale */
+};
+
+/* one per gfx element a driver can have, so the layouts of gfxdecodeinfo
+   never evict each other; further runtime layouts replace the least
+   recently used table */
+#define DECODE_TABLES MAX_GFX_ELEMENTS
+static struct gfx_decode_table decode_tables[DECODE_TABLES];
+static unsigned decode_table_clock;
+static unsigned decode_table_serial;
+
+/* byte -> 8 pixels of 0/1, pixel i in byte i&3 of word i>>2 */
+static UINT32 gather_msb[256][2];
+static UINT32 gather_lsb[256][2];
+
+static void decode_table_free(struct gfx_decode_table *t)
+{
+	free(t->bitoffs);
+	free(t->gather);
+	memset(t,0,sizeof(*t));
+}
+
+static int decode_table_build(struct gfx_decode_table *t,const struct GfxElement *gfx,const struct GfxLayout *gl)
+{
+	int planes = gl->planes;
+	int x,y,plane,g;
+
+	if (gather_msb[1][1] == 0)
+	{
+		int b,i;
+
+		for (b = 0;b < 256;b++)
+			for (i = 0;i < 8;i++)
+			{
+				gather_msb[b][i >> 2] |= ((b >> (7-i)) & 1) << ((i & 3) * 8);
+				gather_lsb[b][i >> 2] |= ((b >> i) & 1) << ((i & 3) * 8);
+			}
+	}
+
+	memcpy(&t->gl,gl,sizeof(t->gl));
+	t->orientation = Machine->orientation;
+	t->width = gfx->width;
+	t->height = gfx->height;
+	t->aligned = (gl->charincrement & 7) == 0;
+	t->groups = gfx->width / 8;
+	t->bitoffs = (UINT32 *) malloc(gfx->width * gfx->height * planes * sizeof(UINT32));
+	t->gather = (UINT8 *) malloc(gfx->height * t->groups + 1);
+	if (!t->bitoffs || !t->gather)
+	{
+		decode_table_free(t);
+		return 1;
+	}
+
+	for (y = 0;y < gfx->height;y++)
+	{
+		int yoffs;
+
+		yoffs = y;
+#ifdef PREROTATE_GFX
+		if (Machine->orientation & ORIENTATION_FLIP_Y)
+			yoffs = gfx->height-1 - yoffs;
+#endif
+
+		for (x = 0;x < gfx->width;x++)
+		{
+			UINT32 *bo = t->bitoffs + (y * gfx->width + x) * planes;
+			int xoffs;
+
+			xoffs = x;
+#ifdef PREROTATE_GFX
+			if (Machine->orientation & ORIENTATION_FLIP_X)
+				xoffs = gfx->width-1 - xoffs;
+#endif
+
+			for (plane = 0;plane < planes;plane++)
+			{
+				if (Machine->orientation & ORIENTATION_SWAP_XY)
+					bo[plane] = gl->planeoffset[plane] + gl->yoffset[xoffs] + gl->xoffset[yoffs];
+				else
+					bo[plane] = gl->planeoffset[plane] + gl->yoffset[yoffs] + gl->xoffset[xoffs];
+			}
+		}
+
+		for (g = 0;g < t->groups;g++)
+		{
+			const UINT32 *bo = t->bitoffs + (y * gfx->width + g * 8) * planes;
+			int msb = t->aligned, lsb = t->aligned;
+			int i;
+
+			for (plane = 0;plane < planes;plane++)
+			{
+				if ((bo[plane] & 7) != 0) msb = 0;
+				if ((bo[plane] & 7) != 7) lsb = 0;
+				for (i = 1;i < 8;i++)
+				{
+					if (bo[i * planes + plane] != bo[plane] + i) msb = 0;
+					if (bo[i * planes + plane] != bo[plane] - i) lsb = 0;
+				}
+			}
+			t->gather[y * t->groups + g] = msb ? GATHER_MSB : lsb ? GATHER_LSB : GATHER_BITS;
+		}
+	}
+
+	return 0;
+}
+
+/* only the fields the table depends on: layouts built on the stack have */
+/* garbage in the unused offsets and padding */
+static int decode_table_match(const struct gfx_decode_table *t,const struct GfxElement *gfx,const struct GfxLayout *gl)
+{
+	if (!t->bitoffs || t->width != gfx->width || t->height != gfx->height ||
+			t->orientation != Machine->orientation ||
+			t->gl.width != gl->width || t->gl.height != gl->height ||
+			t->gl.planes != gl->planes || t->gl.charincrement != gl->charincrement)
+		return 0;
+	return memcmp(t->gl.planeoffset,gl->planeoffset,gl->planes * sizeof(UINT32)) == 0 &&
+			memcmp(t->gl.xoffset,gl->xoffset,gl->width * sizeof(UINT32)) == 0 &&
+			memcmp(t->gl.yoffset,gl->yoffset,gl->height * sizeof(UINT32)) == 0;
+}
+
+/* find or build the table for this element and layout, trying the one the */
+/* element used last before searching. Main thread only. */
+static const struct gfx_decode_table *decode_table_get(struct GfxElement *gfx,const struct GfxLayout *gl)
+{
+	struct gfx_decode_table *t, *lru = &decode_tables[0];
+	int i;
+
+	decode_table_clock++;
+	t = (struct gfx_decode_table *)gfx->decode_table;
+	if (t >= decode_tables && t < decode_tables + DECODE_TABLES &&
+			t->serial == gfx->decode_serial && decode_table_match(t,gfx,gl))
+	{
+		t->used = decode_table_clock;
+		return t;
+	}
+
+	for (i = 0;i < DECODE_TABLES;i++)
+	{
+		t = &decode_tables[i];
+		if (decode_table_match(t,gfx,gl))
+		{
+			t->used = decode_table_clock;
+			gfx->decode_table = t;
+			gfx->decode_serial = t->serial;
+			return t;
+		}
+		/* a free table beats any used one */
+		if (lru->bitoffs && (!t->bitoffs || decode_table_clock - t->used > decode_table_clock - lru->used))
+			lru = t;
+	}
+
+	t = lru;
+	decode_table_free(t);
+	if (decode_table_build(t,gfx,gl))
+		return 0;
+	t->used = decode_table_clock;
+	t->serial = ++decode_table_serial;
+	gfx->decode_table = t;
+	gfx->decode_serial = t->serial;
+	return t;
+}
+
+static void decodechar_table(struct GfxElement *gfx,int num,const UINT8 *src,const struct gfx_decode_table *t)
+{
+	const UINT32 *bo = t->bitoffs;
+	const UINT8 *gather = t->gather;
+	int planes = t->gl.planes;
+	int offs = num * t->gl.charincrement;
+	unsigned int usage = 0;
+	UINT8 *dp;
+	int x,y,plane;
+
+
+	/* with whole-byte chars, index bytes from the char start */
+	if (t->aligned)
+	{
+		src += offs >> 3;
+		offs = 0;
+	}
+
+	dp = gfx->gfxdata + num * gfx->char_modulo;
+	for (y = 0;y < gfx->height;y++)
+	{
+		for (x = 0;x < gfx->width;)
+		{
+			if ((x & 7) == 0 && x + 8 <= gfx->width && gather[x >> 3] != GATHER_BITS)
+			{
+				UINT32 (*spread)[2] = (gather[x >> 3] == GATHER_MSB) ? gather_msb : gather_lsb;
+				UINT32 lo = 0, hi = 0;
+
+				for (plane = 0;plane < planes;plane++)
+				{
+					int b = src[bo[plane] >> 3];
+					lo |= spread[b][0] << (planes-1-plane);
+					hi |= spread[b][1] << (planes-1-plane);
+				}
+				dp[x+0] = lo; dp[x+1] = lo >> 8; dp[x+2] = lo >> 16; dp[x+3] = lo >> 24;
+				dp[x+4] = hi; dp[x+5] = hi >> 8; dp[x+6] = hi >> 16; dp[x+7] = hi >> 24;
+				bo += 8 * planes;
+				x += 8;
+			}
+			else
+			{
+				int pen = 0;
+
+				for (plane = 0;plane < planes;plane++)
+					pen |= readbit(src,offs + bo[plane]) << (planes-1-plane);
+				dp[x] = pen;
+				bo += planes;
+				x++;
+			}
+		}
+
+		if (gfx->pen_usage)
+		{
+			for (x = 0;x < gfx->width;x++)
+				usage |= 1 << dp[x];
+		}
+
+		gather += t->groups;
+		dp += gfx->line_modulo;
+	}
+
+	if (gfx->pen_usage)
+		gfx->pen_usage[num] = usage;
+}
+
+
+void decodechar(struct GfxElement *gfx,int num,const UINT8 *src,const struct GfxLayout *gl)
+{
+	const struct gfx_decode_table *t = decode_table_get(gfx,gl);
+
+	if (t)
+		decodechar_table(gfx,num,src,t);
+	else
+		decodechar_bits(gfx,num,src,gl);
+}
+
+
+struct decodegfx_job
+{
+	struct GfxElement *gfx;
+	const UINT8 *src;
+	const struct gfx_decode_table *table;
+};
+
+static void decodegfx_range(void *param,int start,int end)
+{
+	struct decodegfx_job *job = (struct decodegfx_job *)param;
+	int c;
+
+	for (c = start;c < end;c++)
+		decodechar_table(job->gfx,c,job->src,job->table);
+}
+
+
 struct GfxElement *decodegfx(const UINT8 *src,const struct GfxLayout *gl)
 {
 	int c;
 	struct GfxElement *gfx;
+	struct decodegfx_job job;
 
 
 	if ((gfx = (GfxElement *) malloc(sizeof(struct GfxElement))) == 0)
@@ -163,8 +443,17 @@ struct GfxElement *decodegfx(const UINT8 *src,const struct GfxLayout *gl)
 		gfx->pen_usage = (unsigned int *) malloc(gfx->total_elements * sizeof(int));
 		/* no need to check for failure, the code can work without pen_usage */
 
-	for (c = 0;c < gl->total;c++)
-		decodechar(gfx,c,src,gl);
+	/* chars are independent, so split them over the worker threads */
+	job.gfx = gfx;
+	job.src = src;
+	job.table = decode_table_get(gfx,gl);
+	if (job.table)
+		osd_parallel_for(gl->total,decodegfx_range,&job);
+	else
+	{
+		for (c = 0;c < gl->total;c++)
+			decodechar_bits(gfx,c,src,gl);
+	}
 
 	return gfx;
 }
@@ -174,8 +463,13 @@ void freegfx(struct GfxElement *gfx)
 {
 	if (gfx)
 	{
-		free(gfx->pen_usage);
-		free(gfx->gfxdata);
+		if (gfx->cache)
+			osd_gfxcache_free(gfx);
+		else
+		{
+			free(gfx->pen_usage);
+			free(gfx->gfxdata);
+		}
 		free(gfx);
 	}
 }
@@ -608,6 +902,64 @@ void pdrawgfx(struct osd_bitmap *dest,const struct GfxElement *gfx,
 }
 
 
+/*
+  drawgfxzoom() and tilemap_draw() mark the dirty grid only for draws into
+  the screen bitmap. Private bitmaps they drew into are remembered here and
+  copybitmap() marks every copy from them onto the screen; they stay listed,
+  a draw may come after this frame's copy. With no room left the draw is
+  marked in place, as drawgfx() does.
+*/
+#define UNMARKED_BITMAPS 8
+static struct osd_bitmap *unmarked_bitmap[UNMARKED_BITMAPS];
+
+void mark_dirty_bitmap(struct osd_bitmap *dest,int sx,int sy,int ex,int ey)
+{
+	int i;
+
+	if (dest != Machine->scrbitmap)
+	{
+		for (i = 0;i < UNMARKED_BITMAPS;i++)
+		{
+			if (unmarked_bitmap[i] == dest)
+				return;
+			if (unmarked_bitmap[i] == 0)
+			{
+				unmarked_bitmap[i] = dest;
+				return;
+			}
+		}
+	}
+	osd_mark_dirty (sx,sy,ex,ey,0);
+}
+
+static void mark_dirty_copy(struct osd_bitmap *dest,struct osd_bitmap *src,int sx,int sy,const struct rectangle *clip)
+{
+	int ex = sx + src->width - 1, ey = sy + src->height - 1;
+	int i;
+
+	if (dest != Machine->scrbitmap)
+		return;
+	for (i = 0;i < UNMARKED_BITMAPS && unmarked_bitmap[i] != src;i++)
+		;
+	if (i == UNMARKED_BITMAPS)
+		return;
+
+	if (sx < 0) sx = 0;
+	if (sy < 0) sy = 0;
+	if (ex >= dest->width) ex = dest->width-1;
+	if (ey >= dest->height) ey = dest->height-1;
+	if (clip)
+	{
+		if (sx < clip->min_x) sx = clip->min_x;
+		if (sy < clip->min_y) sy = clip->min_y;
+		if (ex > clip->max_x) ex = clip->max_x;
+		if (ey > clip->max_y) ey = clip->max_y;
+	}
+	if (sx <= ex && sy <= ey)
+		osd_mark_dirty (sx,sy,ex,ey,0);
+}
+
+
 /***************************************************************************
 
   Use drawgfx() to copy a bitmap onto another at the given position.
@@ -701,6 +1053,8 @@ void copybitmap_remap(struct osd_bitmap *dest,struct osd_bitmap *src,int flipx,i
 		}
 	}
 
+	mark_dirty_copy(dest,src,sx,sy,clip);
+
 	if (dest->depth != 16)
 		copybitmap_core8(dest,src,flipx,flipy,sx,sy,clip,transparency,transparent_color);
 	else
@@ -1318,6 +1672,8 @@ INLINE void common_drawgfxzoom( struct osd_bitmap *dest_bmp,const struct GfxElem
 			{ /* skip if inner loop doesn't draw anything */
 				int y;
 
+				mark_dirty_bitmap(dest_bmp,sx,sy,ex-1,ey-1);
+
 				/* case 1: TRANSPARENCY_PEN */
 				if (transparency == TRANSPARENCY_PEN)
 				{
@@ -1718,6 +2074,8 @@ INLINE void common_drawgfxzoom( struct osd_bitmap *dest_bmp,const struct GfxElem
 			{ /* skip if inner loop doesn't draw anything */
 				int y;
 
+				mark_dirty_bitmap(dest_bmp,sx,sy,ex-1,ey-1);
+
 				/* case 1: TRANSPARENCY_PEN */
 				if (transparency == TRANSPARENCY_PEN)
 				{
@@ -51,6 +51,9 @@ struct GfxElement
 	unsigned char *gfxdata;	/* pixel data */
 	int line_modulo;	/* amount to add to get to the next line (usually = width) */
 	int char_modulo;	/* = line_modulo * height */
+	void *cache;	/* decoded-gfx cache mapping gfxdata lives in, 0 if malloc()ed */
+	void *decode_table;	/* decodechar() table last used, checked against decode_serial */
+	unsigned int decode_serial;
 } __attribute__ ((__aligned__ (32)));
 
 struct GfxDecodeInfo
@@ -122,6 +125,7 @@ void pdrawgfx(struct osd_bitmap *dest,const struct GfxElement *gfx,
 		unsigned int code,unsigned int color,int flipx,int flipy,int sx,int sy,
 		const struct rectangle *clip,int transparency,int transparent_color,
 		UINT32 priority_mask);
+void mark_dirty_bitmap(struct osd_bitmap *dest,int sx,int sy,int ex,int ey);
 void copybitmap(struct osd_bitmap *dest,struct osd_bitmap *src,int flipx,int flipy,int sx,int sy,
 		const struct rectangle *clip,int transparency,int transparent_color);
 void copybitmap_remap(struct osd_bitmap *dest,struct osd_bitmap *src,int flipx,int flipy,int sx,int sy,
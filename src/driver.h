@@ -263,6 +263,12 @@ enum
 /* the Z80 can be wired to use 16 bit addressing for I/O ports */
 #define CPU_16BIT_PORT 0x4000
 
+/* set this on an audio CPU that only listens to the other CPUs (sound latches */
+/* and interrupts) and never answers back. Their commands are journaled and */
+/* delivered when it catches up, instead of stopping the sender every time. */
+/* -deferaudio applies it to every CPU_AUDIO_CPU, for trying it on a driver. */
+#define CPU_DEFERRED 0x2000
+
 #define CPU_FLAGS_MASK 0xff00
 
 
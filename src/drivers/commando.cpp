@@ -345,7 +345,7 @@ static struct MachineDriver machine_driver_commando =
 			commando_interrupt,1
 		},
 		{
-			CPU_Z80 | CPU_AUDIO_CPU,
+			CPU_Z80 | CPU_AUDIO_CPU | CPU_DEFERRED,	/* only reads the sound latch */
 			3000000,	/* 3 MHz (?) */
 			sound_readmem,sound_writemem,0,0,
 			interrupt,4
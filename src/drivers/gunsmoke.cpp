@@ -261,7 +261,7 @@ static struct MachineDriver machine_driver_gunsmoke =
 			interrupt,1
 		},
 		{
-			CPU_Z80 | CPU_AUDIO_CPU,
+			CPU_Z80 | CPU_AUDIO_CPU | CPU_DEFERRED,	/* only reads the sound latch */
 			3000000,	/* 3 Mhz (?) */
 			sound_readmem,sound_writemem,0,0,
 			interrupt,4
@@ -1172,6 +1172,9 @@ static struct MachineDriver machine_driver_raster =
 	ROM_LOAD( name,           0x000000, 0x08000, sum ) \
 	ROM_LOAD( "ng-sfix.rom",  0x020000, 0x20000, 0x354029fc )
 
+/* REGION_SOUND1/2 are only read by the YM2610, so a set with a single V ROM
+   per region maps it instead of copying it (REGIONFLAG_READONLY) */
+
 /******************************************************************************/
 
 ROM_START( nam1975 )
@@ -1182,10 +1185,10 @@ ROM_START( nam1975 )
 
 	NEO_BIOS_SOUND_64K( "nam_m1.rom", 0xcd088502 )
 
-	ROM_REGION( 0x080000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x080000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "nam_v11.rom", 0x000000, 0x080000, 0xa7c3d5e5 )
 
-	ROM_REGION( 0x180000, REGION_SOUND2 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x180000, REGION_SOUND2 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "nam_v21.rom", 0x000000, 0x080000, 0x55e670b3 )
 	ROM_LOAD( "nam_v22.rom", 0x080000, 0x080000, 0xab0d8368 )
 	ROM_LOAD( "nam_v23.rom", 0x100000, 0x080000, 0xdf468e28 )
@@ -1207,13 +1210,13 @@ ROM_START( bstars )
 
 	NEO_BIOS_SOUND_64K( "bpro_m1.rom", 0x79a8f4c2 )
 
-	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "bpro_v11.rom", 0x000000, 0x080000, 0xb7b925bd )
 	ROM_LOAD( "bpro_v12.rom", 0x080000, 0x080000, 0x329f26fc )
 	ROM_LOAD( "bpro_v13.rom", 0x100000, 0x080000, 0x0c39f3c8 )
 	ROM_LOAD( "bpro_v14.rom", 0x180000, 0x080000, 0xc7e11c38 )
 
-	ROM_REGION( 0x080000, REGION_SOUND2 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x080000, REGION_SOUND2 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "bpro_v21.rom", 0x000000, 0x080000, 0x04a733d1 )
 
 	ROM_REGION( 0x300000, REGION_GFX2 )
@@ -1234,10 +1237,10 @@ ROM_START( tpgolf )
 
 	NEO_BIOS_SOUND_64K( "topg_m1.rom", 0x7851d0d9 )
 
-	ROM_REGION( 0x080000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x080000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "topg_v11.rom", 0x000000, 0x080000, 0xff97f1cb )
 
-	ROM_REGION( 0x200000, REGION_SOUND2 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x200000, REGION_SOUND2 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "topg_v21.rom", 0x000000, 0x080000, 0xd34960c6 )
 	ROM_LOAD( "topg_v22.rom", 0x080000, 0x080000, 0x9a5f58d4 )
 	ROM_LOAD( "topg_v23.rom", 0x100000, 0x080000, 0x30f53e54 )
@@ -1262,11 +1265,11 @@ ROM_START( mahretsu )
 
 	NEO_BIOS_SOUND_64K( "maj_m1.rom", 0x37965a73 )
 
-	ROM_REGION( 0x100000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x100000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "maj_v1.rom", 0x000000, 0x080000, 0xb2fb2153 )
 	ROM_LOAD( "maj_v2.rom", 0x080000, 0x080000, 0x8503317b )
 
-	ROM_REGION( 0x180000, REGION_SOUND2 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x180000, REGION_SOUND2 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "maj_v3.rom", 0x000000, 0x080000, 0x4999fb27 )
 	ROM_LOAD( "maj_v4.rom", 0x080000, 0x080000, 0x776fa2a2 )
 	ROM_LOAD( "maj_v5.rom", 0x100000, 0x080000, 0xb3e7eeea )
@@ -1286,10 +1289,10 @@ ROM_START( maglord )
 
 	NEO_BIOS_SOUND_64K( "magl_m1.rom", 0x91ee1f73 )
 
-	ROM_REGION( 0x080000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x080000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "magl_v11.rom", 0x000000, 0x080000, 0xcc0455fd )
 
-	ROM_REGION( 0x100000, REGION_SOUND2 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x100000, REGION_SOUND2 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "magl_v21.rom", 0x000000, 0x080000, 0xf94ab5b7 )
 	ROM_LOAD( "magl_v22.rom", 0x080000, 0x080000, 0x232cfd04 )
 
@@ -1310,10 +1313,10 @@ ROM_START( maglordh )
 
 	NEO_BIOS_SOUND_64K( "magl_m1.rom", 0x91ee1f73 )
 
-	ROM_REGION( 0x080000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x080000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "magl_v11.rom", 0x000000, 0x080000, 0xcc0455fd )
 
-	ROM_REGION( 0x100000, REGION_SOUND2 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x100000, REGION_SOUND2 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "magl_v21.rom", 0x000000, 0x080000, 0xf94ab5b7 )
 	ROM_LOAD( "magl_v22.rom", 0x080000, 0x080000, 0x232cfd04 )
 
@@ -1335,11 +1338,11 @@ ROM_START( ridhero )
 
 	NEO_BIOS_SOUND_64K( "n046001a.478", BADCRC ( 0xf7196558 ) )
 
-	ROM_REGION( 0x100000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x100000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "n046001a.178", 0x000000, 0x080000, BADCRC ( 0xcdf74a42 ) )
 	ROM_LOAD( "n046001a.17c", 0x080000, 0x080000, BADCRC ( 0xe2fd2371 ) )
 
-	ROM_REGION( 0x200000, REGION_SOUND2 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x200000, REGION_SOUND2 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "n046001a.278", 0x000000, 0x080000, BADCRC ( 0x94092bce ) )
 	ROM_LOAD( "n046001a.27c", 0x080000, 0x080000, BADCRC ( 0x4e2cd7c3 ) )
 	ROM_LOAD( "n046001b.278", 0x100000, 0x080000, BADCRC ( 0x069c71ed ) )
@@ -1364,11 +1367,11 @@ ROM_START( alpham2 )
 
 	NEO_BIOS_SOUND_128K( "lstg_m1.rom", 0xf23d3076 )
 
-	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "lstg_v11.rom", 0x000000, 0x100000, 0xcd5db931 )
 	ROM_LOAD( "lstg_v12.rom", 0x100000, 0x100000, 0x63e9b574 )
 
-	ROM_REGION( 0x400000, REGION_SOUND2 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x400000, REGION_SOUND2 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "lstg_v21.rom", 0x000000, 0x100000, 0xff7ebf79 )
 	ROM_LOAD( "lstg_v22.rom", 0x080000, 0x100000, 0xf2028490 )
 	ROM_LOAD( "lstg_v23.rom", 0x100000, 0x100000, 0x2e4f1e48 )
@@ -1389,12 +1392,12 @@ ROM_START( ncombat )
 
 	NEO_BIOS_SOUND_128K( "ncom_m1.rom", 0xb5819863 )
 
-	ROM_REGION( 0x180000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x180000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "ncom_v11.rom", 0x000000, 0x080000, 0xcf32a59c )
 	ROM_LOAD( "ncom_v12.rom", 0x080000, 0x080000, 0x7b3588b7 )
 	ROM_LOAD( "ncom_v13.rom", 0x100000, 0x080000, 0x505a01b5 )
 
-	ROM_REGION( 0x080000, REGION_SOUND2 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x080000, REGION_SOUND2 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "ncom_v21.rom", 0x000000, 0x080000, 0x365f9011 )
 
 	ROM_REGION( 0x300000, REGION_GFX2 )
@@ -1414,13 +1417,13 @@ ROM_START( cyberlip )
 
 	NEO_BIOS_SOUND_64K( "cybl_m1.rom", 0x47980d3a )
 
-	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "cybl_v11.rom", 0x000000, 0x080000, 0x90224d22 )
 	ROM_LOAD( "cybl_v12.rom", 0x080000, 0x080000, 0xa0cf1834 )
 	ROM_LOAD( "cybl_v13.rom", 0x100000, 0x080000, 0xae38bc84 )
 	ROM_LOAD( "cybl_v14.rom", 0x180000, 0x080000, 0x70899bd2 )
 
-	ROM_REGION( 0x080000, REGION_SOUND2 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x080000, REGION_SOUND2 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "cybl_v21.rom", 0x000000, 0x080000, 0x586f4cb2 )
 
 	ROM_REGION( 0x300000, REGION_GFX2 )
@@ -1441,11 +1444,11 @@ ROM_START( superspy )
 
 	NEO_BIOS_SOUND_128K( "sspy_m1.rom", 0xd59d5d12 )
 
-	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "sspy_v11.rom", 0x000000, 0x100000, 0x5c674d5c )
 	ROM_LOAD( "sspy_v12.rom", 0x100000, 0x100000, 0x7df8898b )
 
-	ROM_REGION( 0x100000, REGION_SOUND2 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x100000, REGION_SOUND2 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "sspy_v21.rom", 0x000000, 0x100000, 0x1ebe94c7 )
 
 	ROM_REGION( 0x400000, REGION_GFX2 )
@@ -1463,7 +1466,7 @@ ROM_START( mutnat )
 
 	NEO_BIOS_SOUND_128K( "mnat_m1.rom", 0xb6683092 )
 
-	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "mnat_v1.rom", 0x000000, 0x100000, 0x25419296 )
 	ROM_LOAD( "mnat_v2.rom", 0x100000, 0x100000, 0x0de53d5e )
 
@@ -1487,7 +1490,7 @@ ROM_START( kotm )
 
 	NEO_BIOS_SOUND_128K( "n058001a.4f8", BADCRC ( 0x40797389 ) )
 
-	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "n058001a.1f8", 0x000000, 0x080000, BADCRC ( 0xc3df83ba ) )
 	ROM_LOAD( "n058001a.1fc", 0x080000, 0x080000, BADCRC ( 0x22aa6096 ) )
 	ROM_LOAD( "n058001b.1f8", 0x100000, 0x080000, BADCRC ( 0xdf9a4854 ) )
@@ -1523,7 +1526,7 @@ ROM_START( sengoku )
 
 	NEO_BIOS_SOUND_128K( "sngku_m1.rom", 0x9b4f34c6 )
 
-	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "sngku_v1.rom", 0x000000, 0x100000, 0x23663295 )
 	ROM_LOAD( "sngku_v2.rom", 0x100000, 0x100000, 0xf61e6765 )
 
@@ -1545,7 +1548,7 @@ ROM_START( sengokh )
 
 	NEO_BIOS_SOUND_128K( "sngku_m1.rom", 0x9b4f34c6 )
 
-	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "sngku_v1.rom", 0x000000, 0x100000, 0x23663295 )
 	ROM_LOAD( "sngku_v2.rom", 0x100000, 0x100000, 0xf61e6765 )
 
@@ -1566,7 +1569,7 @@ ROM_START( burningf )
 
 	NEO_BIOS_SOUND_128K( "burnf_m1.rom", 0x0c939ee2 )
 
-	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "burnf_v1.rom", 0x000000, 0x100000, 0x508c9ffc )
 	ROM_LOAD( "burnf_v2.rom", 0x100000, 0x100000, 0x854ef277 )
 
@@ -1587,7 +1590,7 @@ ROM_START( burningh )
 
 	NEO_BIOS_SOUND_128K( "burnf_m1.rom", 0x0c939ee2 )
 
-	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "burnf_v1.rom", 0x000000, 0x100000, 0x508c9ffc )
 	ROM_LOAD( "burnf_v2.rom", 0x100000, 0x100000, 0x854ef277 )
 
@@ -1609,11 +1612,11 @@ ROM_START( lbowling )
 
 	NEO_BIOS_SOUND_64K( "n050001a.478", BADCRC ( 0x535ec016 ) )
 
-	ROM_REGION( 0x100000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x100000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "n050001a.178", 0x000000, 0x080000, BADCRC ( 0x0fb74872 ) )
 	ROM_LOAD( "n050001a.17c", 0x080000, 0x080000, BADCRC ( 0x029faa57 ) )
 
-	ROM_REGION( 0x080000, REGION_SOUND2 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x080000, REGION_SOUND2 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "n050001a.278", 0x000000, 0x080000, BADCRC ( 0x2efd5ada ) )
 
 	ROM_REGION( 0x400000, REGION_GFX2 )
@@ -1644,11 +1647,11 @@ ROM_START( gpilots )
 
 	NEO_BIOS_SOUND_128K( "ghst_m1.rom", 0x48409377 )
 
-	ROM_REGION( 0x180000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x180000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "ghst_v11.rom", 0x000000, 0x100000, 0x1b526c8b )
 	ROM_LOAD( "ghst_v12.rom", 0x100000, 0x080000, 0x4a9e6f03 )
 
-	ROM_REGION( 0x080000, REGION_SOUND2 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x080000, REGION_SOUND2 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "ghst_v21.rom", 0x000000, 0x080000, 0x7abf113d )
 
 	ROM_REGION( 0x400000, REGION_GFX2 )
@@ -1666,10 +1669,10 @@ ROM_START( joyjoy )
 
 	NEO_BIOS_SOUND_64K( "joy_m1.rom", 0x058683ec )
 
-	ROM_REGION( 0x080000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x080000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "joy_v1.rom", 0x000000, 0x080000, 0x66c1e5c4 )
 
-	ROM_REGION( 0x080000, REGION_SOUND2 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x080000, REGION_SOUND2 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "joy_v2.rom", 0x000000, 0x080000, 0x8ed20a86 )
 
 	ROM_REGION( 0x100000, REGION_GFX2 )
@@ -1685,10 +1688,10 @@ ROM_START( bjourney )
 
 	NEO_BIOS_SOUND_64K( "bj-m1.rom",  0xa9e30496 )
 
-	ROM_REGION( 0x100000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x100000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "bj-v11.rom", 0x000000, 0x100000, 0x2cb4ad91 )
 
-	ROM_REGION( 0x100000, REGION_SOUND2 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x100000, REGION_SOUND2 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "bj-v22.rom", 0x000000, 0x100000, 0x65a54d13 )
 
 	ROM_REGION( 0x300000, REGION_GFX2 )
@@ -1706,7 +1709,7 @@ ROM_START( quizdais )
 
 	NEO_BIOS_SOUND_128K( "quizd_m1.rom", 0x2a2105e0 )
 
-	ROM_REGION( 0x100000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x100000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "quizd_v1.rom", 0x000000, 0x100000, 0xa53e5bd3 )
 
 	NO_DELTAT_REGION
@@ -1724,7 +1727,7 @@ ROM_START( lresort )
 
 	NEO_BIOS_SOUND_128K( "lr_m1.rom", 0xcec19742 )
 
-	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "lr_v1.rom", 0x000000, 0x100000, 0xefdfa063 )
 	ROM_LOAD( "lr_v2.rom", 0x100000, 0x100000, 0x3c7997c0 )
 
@@ -1746,7 +1749,7 @@ ROM_START( eightman )
 
 	NEO_BIOS_SOUND_128K( "n046001a.4f8", BADCRC ( 0x68b6e0ef ) )
 
-	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "n046001a.1f8", 0x000000, 0x080000, BADCRC ( 0x0a2299b4 ) )
 	ROM_LOAD( "n046001a.1fc", 0x080000, 0x080000, BADCRC ( 0xb695e254 ) )
 	ROM_LOAD( "n046001b.1f8", 0x100000, 0x080000, BADCRC ( 0x6c3c3fec ) )
@@ -1778,11 +1781,11 @@ ROM_START( minasan )
 
 	NEO_BIOS_SOUND_64K( "n054001a.478", BADCRC ( 0x19ef88ea ) )
 
-	ROM_REGION( 0x100000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x100000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "n054001a.178", 0x000000, 0x080000, BADCRC ( 0x79d65e8e ) )
 	ROM_LOAD( "n054001a.17c", 0x080000, 0x080000, BADCRC ( 0x0b3854d5 ) )
 
-	ROM_REGION( 0x100000, REGION_SOUND2 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x100000, REGION_SOUND2 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "n054001a.278", 0x000000, 0x080000, BADCRC ( 0x0100e548 ) )
 	ROM_LOAD( "n054001a.27c", 0x080000, 0x080000, BADCRC ( 0x0c31c5b0 ) )
 
@@ -1813,7 +1816,7 @@ ROM_START( legendos )
 
 	NEO_BIOS_SOUND_64K( "joe_m1.rom", 0x909d4ed9 )
 
-	ROM_REGION( 0x100000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x100000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "joe_v1.rom", 0x000000, 0x100000, 0x85065452 )
 
 	NO_DELTAT_REGION
@@ -1833,7 +1836,7 @@ ROM_START( 2020bb )
 
 	NEO_BIOS_SOUND_128K( "2020_m1.rom", 0x4cf466ec )
 
-	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "2020_v1.rom", 0x000000, 0x100000, 0xd4ca364e )
 	ROM_LOAD( "2020_v2.rom", 0x100000, 0x100000, 0x54994455 )
 
@@ -1854,7 +1857,7 @@ ROM_START( 2020bbh )
 
 	NEO_BIOS_SOUND_128K( "2020_m1.rom", 0x4cf466ec )
 
-	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "2020_v1.rom", 0x000000, 0x100000, 0xd4ca364e )
 	ROM_LOAD( "2020_v2.rom", 0x100000, 0x100000, 0x54994455 )
 
@@ -1875,7 +1878,7 @@ ROM_START( socbrawl )
 
 	NEO_BIOS_SOUND_64K( "sbrl_m1.rom", 0x2f38d5d3 )
 
-	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "sbrl_v1.rom", 0x000000, 0x100000, 0xcc78497e )
 	ROM_LOAD( "sbrl_v2.rom", 0x100000, 0x100000, 0xdda043c6 )
 
@@ -1896,7 +1899,7 @@ ROM_START( roboarmy )
 
 	NEO_BIOS_SOUND_128K( "rarmy_m1.rom", 0x98edc671 )
 
-	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "rarmy_v1.rom", 0x000000, 0x080000, 0xdaff9896 )
 	ROM_LOAD( "rarmy_v2.rom", 0x080000, 0x080000, 0x8781b1bc )
 	ROM_LOAD( "rarmy_v3.rom", 0x100000, 0x080000, 0xb69c1da5 )
@@ -1922,7 +1925,7 @@ ROM_START( fatfury1 )
 
 	NEO_BIOS_SOUND_128K( "ffry_m1.rom", 0xa8603979 )
 
-	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "ffry_v1.rom", 0x000000, 0x100000, 0x212fd20d )
 	ROM_LOAD( "ffry_v2.rom", 0x100000, 0x100000, 0xfa2ae47f )
 
@@ -1944,7 +1947,7 @@ ROM_START( fbfrenzy )
 
 	NEO_BIOS_SOUND_128K( "n046001a.4f8", BADCRC ( 0x079a203c ) )
 
-	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "n046001a.1f8", 0x000000, 0x080000, BADCRC ( 0xd295da77 ) )
 	ROM_LOAD( "n046001a.1fc", 0x080000, 0x080000, BADCRC ( 0x249b7f52 ) )
 	ROM_LOAD( "n046001b.1f8", 0x100000, 0x080000, BADCRC ( 0xe438fb9d ) )
@@ -1978,7 +1981,7 @@ ROM_START( bakatono )
 
 	NEO_BIOS_SOUND_64K( "n058001a.4f8", BADCRC ( 0xa5e05789 ) )
 
-	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "n058001a.1f8", 0x000000, 0x080000, BADCRC ( 0xd3edbde6 ) )
 	ROM_LOAD( "n058001a.1fc", 0x080000, 0x080000, BADCRC ( 0xcc487705 ) )
 	ROM_LOAD( "n058001b.1f8", 0x100000, 0x080000, BADCRC ( 0xe28cf9b3 ) )
@@ -2013,7 +2016,7 @@ ROM_START( crsword )
 
 	NEO_BIOS_SOUND_128K( "csrd_m1.rom", 0x9c384263 )
 
-	ROM_REGION( 0x100000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x100000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "csrd_v1.rom",  0x000000, 0x100000, 0x61fedf65 )
 
 	NO_DELTAT_REGION
@@ -2034,7 +2037,7 @@ ROM_START( trally )
 
 	NEO_BIOS_SOUND_128K( "tral_m1.rom", 0x0908707e )
 
-	ROM_REGION( 0x180000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x180000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "tral_v1.rom", 0x000000, 0x100000, 0x5ccd9fd5 )
 	ROM_LOAD( "tral_v2.rom", 0x100000, 0x080000, 0xddd8d1e6 )
 
@@ -2056,7 +2059,7 @@ ROM_START( kotm2 )
 
 	NEO_BIOS_SOUND_128K( "kotm2_m1.rom", 0x0c5b2ad5 )
 
-	ROM_REGION( 0x300000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x300000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "kotm2_v1.rom", 0x000000, 0x200000, 0x86d34b25 )
 	ROM_LOAD( "kotm2_v2.rom", 0x200000, 0x100000, 0x8fa62a0b )
 
@@ -2082,7 +2085,7 @@ ROM_START( sengoku2 )
 
 	NEO_BIOS_SOUND_128K( "goku2_m1.rom", 0x9902dfa2 )
 
-	ROM_REGION( 0x300000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x300000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "goku2_v1.rom", 0x000000, 0x100000, 0xb3725ced )
 	ROM_LOAD( "goku2_v2.rom", 0x100000, 0x100000, 0xb5e70a0e )
 	ROM_LOAD( "goku2_v3.rom", 0x200000, 0x100000, 0xc5cece01 )
@@ -2104,7 +2107,7 @@ ROM_START( bstars2 )
 
 	NEO_BIOS_SOUND_64K( "star2_m1.rom", 0xb2611c03 )
 
-	ROM_REGION( 0x280000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x280000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "star2_v1.rom", 0x000000, 0x100000, 0xcb1da093 )
 	ROM_LOAD( "star2_v2.rom", 0x100000, 0x100000, 0x1c954a9d )
 	ROM_LOAD( "star2_v3.rom", 0x200000, 0x080000, 0xafaa0180 )
@@ -2126,7 +2129,7 @@ ROM_START( quizdai2 )
 
 	NEO_BIOS_SOUND_128K( "mein_m1.rom", 0xbb19995d )
 
-	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "mein_v1.rom", 0x000000, 0x100000, 0xaf7f8247 )
 	ROM_LOAD( "mein_v2.rom", 0x100000, 0x100000, 0xc6474b59 )
 
@@ -2148,7 +2151,7 @@ ROM_START( 3countb )
 
 	NEO_BIOS_SOUND_128K( "3cb_m1.rom", 0x3377cda3 )
 
-	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "3cb_v1.rom", 0x000000, 0x200000, 0x63688ce8 )
 	ROM_LOAD( "3cb_v2.rom", 0x200000, 0x200000, 0xc69a827b )
 
@@ -2169,7 +2172,7 @@ ROM_START( aof )
 
 	NEO_BIOS_SOUND_128K( "aof_m1.rom", 0x981345f8 )
 
-	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "aof_v2.rom", 0x000000, 0x200000, 0x3ec632ea )
 	ROM_LOAD( "aof_v4.rom", 0x200000, 0x200000, 0x4b0f8e23 )
 
@@ -2196,7 +2199,7 @@ ROM_START( samsho )
 
 	NEO_BIOS_SOUND_128K( "samsh_m1.rom", 0x95170640 )
 
-	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "samsh_v1.rom", 0x000000, 0x200000, 0x37f78a9b )
 	ROM_LOAD( "samsh_v2.rom", 0x200000, 0x200000, 0x568b20cf )
 
@@ -2220,7 +2223,7 @@ ROM_START( tophuntr )
 
 	NEO_BIOS_SOUND_128K( "thunt_m1.rom", 0x3f84bb9f )
 
-	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "thunt_v1.rom", 0x000000, 0x100000, 0xc1f9c2db )
 	ROM_LOAD( "thunt_v2.rom", 0x100000, 0x100000, 0x56254a64 )
 	ROM_LOAD( "thunt_v3.rom", 0x200000, 0x100000, 0x58113fb1 )
@@ -2248,7 +2251,7 @@ ROM_START( fatfury2 )
 
 	NEO_BIOS_SOUND_128K( "fury2_m1.rom", 0x820b0ba7 )
 
-	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "fury2_v1.rom", 0x000000, 0x200000, 0xd9d00784 )
 	ROM_LOAD( "fury2_v2.rom", 0x200000, 0x200000, 0x2c9a4b33 )
 
@@ -2273,7 +2276,7 @@ ROM_START( janshin )
 
 	NEO_BIOS_SOUND_64K( "jans-m1.rom", 0xe191f955 )
 
-	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "jans-v1.rom", 0x000000, 0x200000, 0xf1947d2b )
 
 	NO_DELTAT_REGION
@@ -2292,7 +2295,7 @@ ROM_START( androdun )
 
 	NEO_BIOS_SOUND_128K( "adun_m1.rom", 0x1a009f8c )
 
-	ROM_REGION( 0x100000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x100000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "adun_v1.rom", 0x000000, 0x080000, 0x577c85b3 )
 	ROM_LOAD( "adun_v2.rom", 0x080000, 0x080000, 0xe14551c4 )
 
@@ -2316,7 +2319,7 @@ ROM_START( ncommand )
 
 	NEO_BIOS_SOUND_64K( "n054001a.4f8", BADCRC ( 0x26e93026 ) )
 
-	ROM_REGION( 0x180000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x180000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "n054001a.1f8", 0x000000, 0x080000, BADCRC ( 0x222e71c8 ) )
 	ROM_LOAD( "n054001a.1fc", 0x080000, 0x080000, BADCRC ( 0x12acd064 ) )
 	ROM_LOAD( "n054001b.1f8", 0x100000, 0x080000, BADCRC ( 0x80b8a984 ) )
@@ -2350,7 +2353,7 @@ ROM_START( viewpoin )
 
 	NEO_BIOS_SOUND_64K( "viewp_m1.rom", 0xd57bd7af )
 
-	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "viewp_v1.rom", 0x000000, 0x200000, 0x019978b6 )
 	ROM_LOAD( "viewp_v2.rom", 0x200000, 0x200000, 0x5758f38c )
 
@@ -2371,7 +2374,7 @@ ROM_START( ssideki )
 
 	NEO_BIOS_SOUND_128K( "sidek_m1.rom", 0x49f17d2d )
 
-	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "sidek_v1.rom", 0x000000, 0x200000, 0x22c097a5 )
 
 	NO_DELTAT_REGION
@@ -2392,7 +2395,7 @@ ROM_START( wh1 )
 
 	NEO_BIOS_SOUND_128K( "wh_m1.rom", 0x1bd9d04b )
 
-	ROM_REGION( 0x300000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x300000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "wh_v2.rom", 0x000000, 0x200000, 0xa68df485 )
 	ROM_LOAD( "wh_v4.rom", 0x200000, 0x100000, 0x7bea8f66 )
 
@@ -2416,7 +2419,7 @@ ROM_START( kof94 )
 
 	NEO_BIOS_SOUND_128K( "kof94_m1.rom", 0xf6e77cf5 )
 
-	ROM_REGION( 0x600000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x600000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "kof94_v1.rom", 0x000000, 0x200000, 0x8889596d )
 	ROM_LOAD( "kof94_v2.rom", 0x200000, 0x200000, 0x25022b27 )
 	ROM_LOAD( "kof94_v3.rom", 0x400000, 0x200000, 0x83cf32c0 )
@@ -2442,7 +2445,7 @@ ROM_START( aof2 )
 
 	NEO_BIOS_SOUND_128K( "aof2_m1.rom", 0xf27e9d52 )
 
-	ROM_REGION( 0x500000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x500000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "aof2_v1.rom", 0x000000, 0x200000, 0x4628fde0 )
 	ROM_LOAD( "aof2_v2.rom", 0x200000, 0x200000, 0xb710e2f2 )
 	ROM_LOAD( "aof2_v3.rom", 0x400000, 0x100000, 0xd168c301 )
@@ -2469,7 +2472,7 @@ ROM_START( wh2 )
 
 	NEO_BIOS_SOUND_128K( "hero2_m1.rom", 0x8fa3bc77 )
 
-	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "hero2_v1.rom", 0x000000, 0x200000, 0x8877e301 )
 	ROM_LOAD( "hero2_v2.rom", 0x200000, 0x200000, 0xc1317ff4 )
 
@@ -2494,7 +2497,7 @@ ROM_START( fatfursp )
 
 	NEO_BIOS_SOUND_128K( "ffspe_m1.rom", 0xccc5186e )
 
-	ROM_REGION( 0x500000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x500000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "ffspe_v1.rom", 0x000000, 0x200000, 0x55d7ce84 )
 	ROM_LOAD( "ffspe_v2.rom", 0x200000, 0x200000, 0xee080b10 )
 	ROM_LOAD( "ffspe_v3.rom", 0x400000, 0x100000, 0xf9eb3d4a )
@@ -2519,7 +2522,7 @@ ROM_START( savagere )
 
 	NEO_BIOS_SOUND_128K( "savag_m1.rom", 0x29992eba )
 
-	ROM_REGION( 0x600000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x600000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "savag_v1.rom", 0x000000, 0x200000, 0x530c50fd )
 	ROM_LOAD( "savag_v2.rom", 0x200000, 0x200000, 0xe79a9bd0 )
 	ROM_LOAD( "savag_v3.rom", 0x400000, 0x200000, 0x7038c2f9 )
@@ -2546,7 +2549,7 @@ ROM_START( fightfev )
 
 	NEO_BIOS_SOUND_128K( "ff_m1.rom", 0x0b7c4e65 )
 
-	ROM_REGION(  0x300000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION(  0x300000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "ff_v1.rom", 0x000000, 0x200000, 0xf417c215 )
 	ROM_LOAD( "ff_v2.rom", 0x200000, 0x100000, 0x64470036 )
 
@@ -2567,7 +2570,7 @@ ROM_START( ssideki2 )
 
 	NEO_BIOS_SOUND_128K( "kick2_m1.rom", 0x156f6951 )
 
-	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "kick2_v1.rom", 0x000000, 0x200000, 0xf081c8d3 )
 	ROM_LOAD( "kick2_v2.rom", 0x200000, 0x200000, 0x7cd63302 )
 
@@ -2589,7 +2592,7 @@ ROM_START( spinmast )
 
 	NEO_BIOS_SOUND_128K( "spnm_m1.rom", 0x76108b2f )
 
-	ROM_REGION( 0x100000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x100000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "spnm_v1.rom", 0x000000, 0x100000, 0xcc281aef )
 
 	NO_DELTAT_REGION
@@ -2614,7 +2617,7 @@ ROM_START( samsho2 )
 
 	NEO_BIOS_SOUND_128K( "sams2_m1.rom", 0x56675098 )
 
-	ROM_REGION( 0x700000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x700000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "sams2_v1.rom", 0x000000, 0x200000, 0x37703f91 )
 	ROM_LOAD( "sams2_v2.rom", 0x200000, 0x200000, 0x0142bde8 )
 	ROM_LOAD( "sams2_v3.rom", 0x400000, 0x200000, 0xd07fa5ca )
@@ -2642,7 +2645,7 @@ ROM_START( wh2j )
 
 	NEO_BIOS_SOUND_128K( "wh2j_m1.rom", 0xd2eec9d3 )
 
-	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "wh2j_v1.rom", 0x000000, 0x200000, 0xaa277109 )
 	ROM_LOAD( "wh2j_v2.rom", 0x200000, 0x200000, 0xb6527edd )
 
@@ -2667,7 +2670,7 @@ ROM_START( wjammers )
 
 	NEO_BIOS_SOUND_128K( "windj_m1.rom", 0x52c23cfc )
 
-	ROM_REGION( 0x380000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x380000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "windj_v1.rom", 0x000000, 0x100000, 0xce8b3698 )
 	ROM_LOAD( "windj_v2.rom", 0x100000, 0x100000, 0x659f9b96 )
 	ROM_LOAD( "windj_v3.rom", 0x200000, 0x100000, 0x39f73061 )
@@ -2690,7 +2693,7 @@ ROM_START( karnovr )
 
 	NEO_BIOS_SOUND_128K( "karev_m1.rom", 0x030beae4 )
 
-	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "karev_v1.rom", 0x000000, 0x200000, 0x0b7ea37a )
 
 	NO_DELTAT_REGION
@@ -2712,7 +2715,7 @@ ROM_START( gururin )
 
 	NEO_BIOS_SOUND_64K( "gurin_m1.rom", 0x833cdf1b )
 
-	ROM_REGION( 0x80000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x80000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "gurin_v1.rom", 0x000000, 0x80000, 0xcf23afd0 )
 
 	NO_DELTAT_REGION
@@ -2730,7 +2733,7 @@ ROM_START( pspikes2 )
 
 	NEO_BIOS_SOUND_128K( "spike_m1.rom", 0xb1c7911e )
 
-	ROM_REGION( 0x300000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x300000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "spike_v1.rom", 0x000000, 0x100000, 0x2ced86df )	/* == pbobble */
 	ROM_LOAD( "spike_v2.rom", 0x100000, 0x100000, 0x970851ab )	/* == pbobble */
 	ROM_LOAD( "spike_v3.rom", 0x200000, 0x100000, 0x81ff05aa )
@@ -2755,7 +2758,7 @@ ROM_START( fatfury3 )
 
 	NEO_BIOS_SOUND_128K( "fury3_m1.rom", 0xfce72926 )
 
-	ROM_REGION( 0xa00000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0xa00000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "fury3_v1.rom", 0x000000, 0x400000, 0x2bdbd4db )
 	ROM_LOAD( "fury3_v2.rom", 0x400000, 0x400000, 0xa698a487 )
 	ROM_LOAD( "fury3_v3.rom", 0x800000, 0x200000, 0x581c5304 )
@@ -2785,7 +2788,7 @@ ROM_START( panicbom )
 
 	NEO_BIOS_SOUND_128K( "panic_m1.rom", 0x3cdf5d88 )
 
-	ROM_REGION( 0x300000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x300000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "panic_v1.rom", 0x000000, 0x200000, 0x7fc86d2f )
 	ROM_LOAD( "panic_v2.rom", 0x200000, 0x100000, 0x082adfc7 )
 
@@ -2805,7 +2808,7 @@ ROM_START( aodk )
 
 	NEO_BIOS_SOUND_128K( "aodk_m1.rom", 0x5a52a9d1 )
 
-	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "aodk_v1.rom", 0x000000, 0x200000, 0x7675b8fa )
 	ROM_LOAD( "aodk_v2.rom", 0x200000, 0x200000, 0xa9da86e9 )
 
@@ -2831,7 +2834,7 @@ ROM_START( sonicwi2 )
 
 	NEO_BIOS_SOUND_128K( "afig2_m1.rom", 0xbb828df1 )
 
-	ROM_REGION( 0x280000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x280000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "afig2_v1.rom", 0x000000, 0x200000, 0x7577e949 )
 	ROM_LOAD( "afig2_v2.rom", 0x200000, 0x080000, 0x6d0a728e )
 
@@ -2852,7 +2855,7 @@ ROM_START( zedblade )
 
 	NEO_BIOS_SOUND_128K( "zedbl_m1.rom", 0x7b5f3d0a )
 
-	ROM_REGION( 0x500000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x500000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "zedbl_v1.rom", 0x000000, 0x200000, 0x1a21d90c )
 	ROM_LOAD( "zedbl_v2.rom", 0x200000, 0x200000, 0xb61686c3 )
 	ROM_LOAD( "zedbl_v3.rom", 0x400000, 0x100000, 0xb90658fa )
@@ -2875,7 +2878,7 @@ ROM_START( galaxyfg )
 
 	NEO_BIOS_SOUND_128K( "galfi_m1.rom", 0x8e9e3b10 )
 
-	ROM_REGION( 0x500000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x500000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "galfi_v1.rom", 0x000000, 0x200000, 0xe3b735ac )
 	ROM_LOAD( "galfi_v2.rom", 0x200000, 0x200000, 0x6a8e78c2 )
 	ROM_LOAD( "galfi_v3.rom", 0x400000, 0x100000, 0x70bca656 )
@@ -2901,7 +2904,7 @@ ROM_START( strhoop )
 
 	NEO_BIOS_SOUND_64K( "shoop_m1.rom", 0x1a5f08db )
 
-	ROM_REGION( 0x280000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x280000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "shoop_v1.rom", 0x000000, 0x200000, 0x718a2400 )
 	ROM_LOAD( "shoop_v2.rom", 0x200000, 0x080000, 0xb19884f8 )
 
@@ -2922,7 +2925,7 @@ ROM_START( quizkof )
 
 	NEO_BIOS_SOUND_128K( "qkof-m1.rom", 0xf5f44172 )
 
-	ROM_REGION( 0x600000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x600000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "qkof-v1.rom", 0x000000, 0x200000, 0x0be18f60 )
 	ROM_LOAD( "qkof-v2.rom", 0x200000, 0x200000, 0x4abde3ff )
 	ROM_LOAD( "qkof-v3.rom", 0x400000, 0x200000, 0xf02844e2 )
@@ -2945,7 +2948,7 @@ ROM_START( ssideki3 )
 
 	NEO_BIOS_SOUND_128K( "side3_m1.rom", 0x82fcd863 )
 
-	ROM_REGION( 0x600000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x600000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "side3_v1.rom", 0x000000, 0x200000, 0x201fa1e1 )
 	ROM_LOAD( "side3_v2.rom", 0x200000, 0x200000, 0xacf29d96 )
 	ROM_LOAD( "side3_v3.rom", 0x400000, 0x200000, 0xe524e415 )
@@ -2970,7 +2973,7 @@ ROM_START( doubledr )
 
 	NEO_BIOS_SOUND_128K( "ddrag_m1.rom", 0x10b144de )
 
-	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "ddrag_v1.rom", 0x000000, 0x200000, 0xcc1128e4 )
 	ROM_LOAD( "ddrag_v2.rom", 0x200000, 0x200000, 0xc3ff5554 )
 
@@ -2995,7 +2998,7 @@ ROM_START( pbobble )
 
 	NEO_BIOS_SOUND_64K( "puzzb_m1.rom", 0x129e6054 )
 
-	ROM_REGION( 0x380000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x380000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	/* 0x000000-0x1fffff empty */
 	ROM_LOAD( "puzzb_v3.rom", 0x200000, 0x100000, 0x0840cbc4 )
 	ROM_LOAD( "puzzb_v4.rom", 0x300000, 0x080000, 0x0a548948 )
@@ -3016,7 +3019,7 @@ ROM_START( kof95 )
 
 	NEO_BIOS_SOUND_128K( "kof95_m1.rom", 0x6f2d7429 )
 
-	ROM_REGION( 0x900000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x900000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "kof95_v1.rom", 0x000000, 0x400000, 0x21469561 )
 	ROM_LOAD( "kof95_v2.rom", 0x400000, 0x200000, 0xb38a2803 )
 	/* 600000-7fffff empty */
@@ -3050,7 +3053,7 @@ ROM_START( tws96 )
 
 	NEO_BIOS_SOUND_64K( "tecmo_m1.rom", 0x860ba8c7 )
 
-	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "tecmo_v1.rom", 0x000000, 0x200000, 0x97bf1986 )
 	ROM_LOAD( "tecmo_v2.rom", 0x200000, 0x200000, 0xb7eb05df )
 
@@ -3074,7 +3077,7 @@ ROM_START( samsho3 )
 
 	NEO_BIOS_SOUND_128K( "sams3_m1.rom", 0x8e6440eb )
 
-	ROM_REGION( 0x600000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x600000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "sams3_v1.rom", 0x000000, 0x400000, 0x84bdd9a0 )
 	ROM_LOAD( "sams3_v2.rom", 0x400000, 0x200000, 0xac0f261a )
 
@@ -3108,7 +3111,7 @@ ROM_START( stakwin )
 
 	NEO_BIOS_SOUND_128K( "stakw_m1.rom", 0x2fe1f499 )
 
-	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "stakw_v1.rom", 0x000000, 0x200000, 0xb7785023 )
 
 	NO_DELTAT_REGION
@@ -3129,7 +3132,7 @@ ROM_START( pulstar )
 
 	NEO_BIOS_SOUND_128K( "pstar_m1.rom", 0xff3df7c7 )
 
-	ROM_REGION( 0x800000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x800000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "pstar_v1.rom", 0x000000, 0x400000, 0xb458ded2 )
 	ROM_LOAD( "pstar_v2.rom", 0x400000, 0x400000, 0x9d2db551 )
 
@@ -3163,7 +3166,7 @@ ROM_START( whp )
 
 	NEO_BIOS_SOUND_128K( "whp_m1.rom", 0x28065668 )
 
-	ROM_REGION( 0x600000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x600000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "whp_v1.rom", 0x000000, 0x200000, 0x30cf2709 )
 	ROM_LOAD( "whp_v2.rom", 0x200000, 0x200000, 0xb6527edd )
 	ROM_LOAD( "whp_v3.rom", 0x400000, 0x200000, 0x1908a7ce )
@@ -3196,7 +3199,7 @@ ROM_START( kabukikl )
 
 	NEO_BIOS_SOUND_128K( "klash_m1.rom", 0x91957ef6 )
 
-	ROM_REGION( 0x700000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x700000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "klash_v1.rom", 0x000000, 0x200000, 0x69e90596 )
 	ROM_LOAD( "klash_v2.rom", 0x200000, 0x200000, 0x7abdb75d )
 	ROM_LOAD( "klash_v3.rom", 0x400000, 0x200000, 0xeccc98d3 )
@@ -3223,7 +3226,7 @@ ROM_START( neobombe )
 
 	NEO_BIOS_SOUND_128K( "bombm_m1.rom", 0xe81e780b )
 
-	ROM_REGION( 0x600000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x600000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "bombm_v1.rom", 0x200000, 0x200000, 0x43057e99 )
 	ROM_CONTINUE(             0x000000, 0x200000 )
 	ROM_LOAD( "bombm_v2.rom", 0x400000, 0x200000, 0xa92b8b3d )
@@ -3248,7 +3251,7 @@ ROM_START( gowcaizr )
 
 	NEO_BIOS_SOUND_128K( "vfgow_m1.rom", 0x78c851cb )
 
-	ROM_REGION( 0x500000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x500000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "vfgow_v1.rom", 0x000000, 0x200000, 0x6c31223c )
 	ROM_LOAD( "vfgow_v2.rom", 0x200000, 0x200000, 0x8edb776c )
 	ROM_LOAD( "vfgow_v3.rom", 0x400000, 0x100000, 0xc63b9285 )
@@ -3275,7 +3278,7 @@ ROM_START( rbff1 )
 
 	NEO_BIOS_SOUND_128K( "rbff1_m1.rom", 0x653492a7 )
 
-	ROM_REGION( 0xc00000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0xc00000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "rbff1_v1.rom", 0x000000, 0x400000, 0xb41cbaa2 )
 	ROM_LOAD( "rbff1_v2.rom", 0x400000, 0x400000, 0xa698a487 )
 	ROM_LOAD( "rbff1_v3.rom", 0x800000, 0x400000, 0x189d1c6c )
@@ -3310,7 +3313,7 @@ ROM_START( aof3 )
 
 	NEO_BIOS_SOUND_128K( "aof3_m1.rom", 0xcb07b659 )
 
-	ROM_REGION( 0x600000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x600000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "aof3_v1.rom", 0x000000, 0x200000, 0xe2c32074 )
 	ROM_LOAD( "aof3_v2.rom", 0x200000, 0x200000, 0xa290eee7 )
 	ROM_LOAD( "aof3_v3.rom", 0x400000, 0x200000, 0x199d12ea )
@@ -3345,7 +3348,7 @@ ROM_START( sonicwi3 )
 
 	NEO_BIOS_SOUND_128K( "sonw3_m1.rom", 0xb20e4291 )
 
-	ROM_REGION( 0x500000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x500000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "sonw3_v1.rom", 0x000000, 0x400000, 0x6f885152 )
 	ROM_LOAD( "sonw3_v2.rom", 0x400000, 0x100000, 0x32187ccd )
 
@@ -3369,7 +3372,7 @@ ROM_START( turfmast )
 
 	NEO_BIOS_SOUND_128K( "turfm_m1.rom", 0x9994ac00 )
 
-	ROM_REGION( 0x800000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x800000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "turfm_v1.rom", 0x000000, 0x200000, 0x00fd48d2 )
 	ROM_LOAD( "turfm_v2.rom", 0x200000, 0x200000, 0x082acb31 )
 	ROM_LOAD( "turfm_v3.rom", 0x400000, 0x200000, 0x7abca053 )
@@ -3393,7 +3396,7 @@ ROM_START( mslug )
 
 	NEO_BIOS_SOUND_128K( "mslug_m1.rom", 0xc28b3253 )
 
-	ROM_REGION( 0x800000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x800000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "mslug_v1.rom", 0x000000, 0x400000, 0x23d22ed1 )
 	ROM_LOAD( "mslug_v2.rom", 0x400000, 0x400000, 0x472cf9db )
 
@@ -3418,7 +3421,7 @@ ROM_START( puzzledp )
 
 	NEO_BIOS_SOUND_128K( "pdpon_m1.rom", 0x9c0291ea )
 
-	ROM_REGION( 0x080000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x080000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "pdpon_v1.rom", 0x000000, 0x080000, 0xdebeb8fb )
 
 	NO_DELTAT_REGION
@@ -3436,7 +3439,7 @@ ROM_START( mosyougi )
 
 	NEO_BIOS_SOUND_128K( "syoug_m1.rom", 0xa602c2c2 )
 
-	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "syoug_v1.rom", 0x000000, 0x200000, 0xbaa2b9a5 )
 
 	NO_DELTAT_REGION
@@ -3454,7 +3457,7 @@ ROM_START( marukodq )
 
 	NEO_BIOS_SOUND_128K( "maru-m1.rom", 0x0e22902e )
 
-	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "maru-v1.rom", 0x000000, 0x200000, 0x5385eca8 )
 	ROM_LOAD( "maru-v2.rom", 0x200000, 0x200000, 0xf8c55404 )
 
@@ -3475,7 +3478,7 @@ ROM_START( neomrdo )
 
 	NEO_BIOS_SOUND_128K( "neomd-m1.rom", 0x81eade02 )
 
-	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "neomd-v1.rom", 0x000000, 0x200000, 0x4143c052 )
 
 	NO_DELTAT_REGION
@@ -3494,7 +3497,7 @@ ROM_START( sdodgeb )
 
 	NEO_BIOS_SOUND_128K( "dodge_m1.rom", 0x0a5f3325 )
 
-	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "dodge_v1.rom", 0x000000, 0x200000, 0x8b53e945 )
 	ROM_LOAD( "dodge_v2.rom", 0x200000, 0x200000, 0xaf37ebf8 )
 
@@ -3516,7 +3519,7 @@ ROM_START( goalx3 )
 
 	NEO_BIOS_SOUND_64K( "goal!_m1.rom", 0xdd945773 )
 
-	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "goal!_v1.rom", 0x000000, 0x200000, 0xef214212 )
 
 	NO_DELTAT_REGION
@@ -3539,7 +3542,7 @@ ROM_START( overtop )
 
 	NEO_BIOS_SOUND_128K( "ovr_m1.rom", 0xfcab6191 )
 
-	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "ovr_v1.rom", 0x000000, 0x400000, 0x013d4ef9 )
 
 	NO_DELTAT_REGION
@@ -3562,7 +3565,7 @@ ROM_START( neodrift )
 
 	NEO_BIOS_SOUND_128K( "drift_m1.rom", 0x200045f1 )
 
-	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "drift_v1.rom", 0x000000, 0x200000, 0xa421c076 )
 	ROM_LOAD( "drift_v2.rom", 0x200000, 0x200000, 0x233c7dd9 )
 
@@ -3584,7 +3587,7 @@ ROM_START( kof96 )
 
 	NEO_BIOS_SOUND_128K( "kof96_m1.rom", 0xdabc427c )
 
-	ROM_REGION( 0xa00000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0xa00000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "kof96_v1.rom", 0x000000, 0x400000, 0x63f7b045 )
 	ROM_LOAD( "kof96_v2.rom", 0x400000, 0x400000, 0x25929059 )
 	ROM_LOAD( "kof96_v3.rom", 0x800000, 0x200000, 0x92a2257d )
@@ -3613,7 +3616,7 @@ ROM_START( ssideki4 )
 
 	NEO_BIOS_SOUND_128K( "side4_m1.rom", 0xa932081d )
 
-	ROM_REGION( 0x600000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x600000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "side4_v1.rom", 0x200000, 0x200000, 0xc4bfed62 )
 	ROM_CONTINUE(             0x000000, 0x200000 )
 	ROM_LOAD( "side4_v2.rom", 0x400000, 0x200000, 0x1bfa218b )
@@ -3642,7 +3645,7 @@ ROM_START( kizuna )
 
 	NEO_BIOS_SOUND_128K( "ke_m1.rom", 0x1b096820 )
 
-	ROM_REGION( 0x800000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x800000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "ke_v1.rom", 0x000000, 0x200000, 0x530c50fd )
 	ROM_LOAD( "ke_v2.rom", 0x200000, 0x200000, 0x03667a8d )
 	ROM_LOAD( "ke_v3.rom", 0x400000, 0x200000, 0x7038c2f9 )
@@ -3674,7 +3677,7 @@ ROM_START( ninjamas )
 
 	NEO_BIOS_SOUND_128K( "ninjm_m1.rom", 0xd00fb2af )
 
-	ROM_REGION( 0x600000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x600000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "ninjm_v1.rom", 0x000000, 0x400000, 0x1c34e013 )
 	ROM_LOAD( "ninjm_v2.rom", 0x400000, 0x200000, 0x22f1c681 )
 
@@ -3710,7 +3713,7 @@ ROM_START( ragnagrd )
 
 	NEO_BIOS_SOUND_128K( "rgard_m1.rom", 0x17028bcf )
 
-	ROM_REGION( 0x800000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x800000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "rgard_v1.rom", 0x000000, 0x400000, 0x61eee7f4 )
 	ROM_LOAD( "rgard_v2.rom", 0x400000, 0x400000, 0x6104e20b )
 
@@ -3746,7 +3749,7 @@ ROM_START( pgoal )
 
 	NEO_BIOS_SOUND_128K( "pgoal_m1.rom", 0x958efdc8 )
 
-	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "pgoal_v1.rom", 0x000000, 0x200000, 0x2cc1bd05 )
 	ROM_LOAD( "pgoal_v2.rom", 0x200000, 0x200000, 0x06ac1d3f )
 
@@ -3769,7 +3772,7 @@ ROM_START( magdrop2 )
 
 	NEO_BIOS_SOUND_128K( "drop2_m1.rom", 0xbddae628 )
 
-	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "drop2_v1.rom", 0x000000, 0x200000, 0x7e5e53e4 )
 
 	NO_DELTAT_REGION
@@ -3789,7 +3792,7 @@ ROM_START( samsho4 )
 
 	NEO_BIOS_SOUND_128K( "sams4_m1.rom", 0x7615bc1b )
 
-	ROM_REGION( 0xa00000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0xa00000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "sams4_v1.rom", 0x000000, 0x400000, 0x7d6ba95f )
 	ROM_LOAD( "sams4_v2.rom", 0x400000, 0x400000, 0x6c33bb5d )
 	ROM_LOAD( "sams4_v3.rom", 0x800000, 0x200000, 0x831ea8c0 )
@@ -3827,7 +3830,7 @@ ROM_START( rbffspec )
 
 	NEO_BIOS_SOUND_128K( "rbffs_m1.rom", 0x3fee46bf )
 
-	ROM_REGION( 0xc00000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0xc00000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "rbffs_v1.rom", 0x000000, 0x400000, 0x76673869 )
 	ROM_LOAD( "rbffs_v2.rom", 0x400000, 0x400000, 0x7a275acd )
 	ROM_LOAD( "rbffs_v3.rom", 0x800000, 0x400000, 0x5a797fd2 )
@@ -3864,7 +3867,7 @@ ROM_START( twinspri )
 
 	NEO_BIOS_SOUND_128K( "sprit_m1.rom", 0x364d6f96 )
 
-	ROM_REGION( 0x600000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x600000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "sprit_v1.rom", 0x000000, 0x400000, 0xff57f088 )
 	ROM_LOAD( "sprit_v2.rom", 0x400000, 0x200000, 0x7ad26599 )
 
@@ -3888,7 +3891,7 @@ ROM_START( wakuwak7 )
 
 	NEO_BIOS_SOUND_128K( "waku7_m1.rom", 0x0634bba6 )
 
-	ROM_REGION( 0x800000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x800000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "waku7_v1.rom", 0x000000, 0x400000, 0x6195c6b4 )
 	ROM_LOAD( "waku7_v2.rom", 0x400000, 0x400000, 0x6159c5fe )
 
@@ -3918,7 +3921,7 @@ ROM_START( stakwin2 )
 
 	NEO_BIOS_SOUND_128K( "sw2_m1.rom", 0xc8e5e0f9 )
 
-	ROM_REGION( 0x800000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x800000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "sw2_v1.rom", 0x000000, 0x400000, 0xb8f24181 )
 	ROM_LOAD( "sw2_v2.rom", 0x400000, 0x400000, 0xee39e260 )
 
@@ -3940,7 +3943,7 @@ ROM_START( breakers )
 
 	NEO_BIOS_SOUND_128K( "break_m1.rom", 0x3951a1c1 )
 
-	ROM_REGION( 0x800000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x800000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "break_v1.rom", 0x000000, 0x400000, 0x7f9ed279 )
 	ROM_LOAD( "break_v2.rom", 0x400000, 0x400000, 0x1d43e420 )
 
@@ -3961,7 +3964,7 @@ ROM_START( miexchng )
 
 	NEO_BIOS_SOUND_128K( "miex-m1.rom", 0xde41301b )
 
-	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x400000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "miex-v1.rom", 0x000000, 0x400000, 0x113fb898 )
 
 	NO_DELTAT_REGION
@@ -3982,7 +3985,7 @@ ROM_START( kof97 )
 
 	NEO_BIOS_SOUND_128K( "kof97_m1.rom", 0x45348747 )
 
-	ROM_REGION( 0xc00000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0xc00000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "kof97_v1.rom", 0x000000, 0x400000, 0x22a2b5b5 )
 	ROM_LOAD( "kof97_v2.rom", 0x400000, 0x400000, 0x2304e744 )
 	ROM_LOAD( "kof97_v3.rom", 0x800000, 0x400000, 0x759eb954 )
@@ -4006,7 +4009,7 @@ ROM_START( magdrop3 )
 
 	NEO_BIOS_SOUND_128K( "drop3_m1.rom", 0x5beaf34e )
 
-	ROM_REGION( 0x480000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x480000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "drop3_v1.rom", 0x000000, 0x400000, 0x58839298 )
 	ROM_LOAD( "drop3_v2.rom", 0x400000, 0x080000, 0xd5e30df4 )
 
@@ -4032,7 +4035,7 @@ ROM_START( lastblad )
 
 	NEO_BIOS_SOUND_128K( "lb_m1.rom", 0x087628ea )
 
-	ROM_REGION( 0xe00000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0xe00000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "lb_v1.rom", 0x000000, 0x400000, 0xed66b76f )
 	ROM_LOAD( "lb_v2.rom", 0x400000, 0x400000, 0xa0e7f6e2 )
 	ROM_LOAD( "lb_v3.rom", 0x800000, 0x400000, 0xa506e1e2 )
@@ -4057,7 +4060,7 @@ ROM_START( puzzldpr )
 
 	NEO_BIOS_SOUND_128K( "pdpon_m1.rom", 0x9c0291ea )
 
-	ROM_REGION( 0x080000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x080000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "pdpon_v1.rom", 0x000000, 0x080000, 0xdebeb8fb )
 
 	NO_DELTAT_REGION
@@ -4080,10 +4083,10 @@ ROM_START( irrmaze )
 	ROM_LOAD( "ng-sm1.rom", 0x00000, 0x20000, 0x97cf998b )	/* we don't use the BIOS anyway... */
 	ROM_LOAD( "im_m1.rom",  0x00000, 0x20000, 0x880a1abd )	/* so overwrite it with the real thing */
 
-	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "im_v1.rom", 0x000000, 0x200000, 0x5f89c3b4 )
 
-	ROM_REGION( 0x100000, REGION_SOUND2 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x100000, REGION_SOUND2 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "im_v2.rom", 0x000000, 0x100000, 0x1e843567 )
 
 	ROM_REGION( 0x0800000, REGION_GFX2 )
@@ -4099,7 +4102,7 @@ ROM_START( popbounc )
 
 	NEO_BIOS_SOUND_128K( "pnb-m1.rom", 0xd4c946dd )
 
-	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "pnb-v1.rom", 0x000000, 0x200000, 0xedcb1beb )
 
 	NO_DELTAT_REGION
@@ -4119,7 +4122,7 @@ ROM_START( shocktro )
 
 	NEO_BIOS_SOUND_128K( "shock_m1.rom", 0x075b9518 )
 
-	ROM_REGION( 0x600000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x600000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "shock_v1.rom", 0x000000, 0x400000, 0x260c0bef )
 	ROM_LOAD( "shock_v2.rom", 0x400000, 0x200000, 0x4ad7d59e )
 
@@ -4155,7 +4158,7 @@ ROM_START( blazstar )
 
 	NEO_BIOS_SOUND_128K( "bstar_m1.rom", 0xd31a3aea )
 
-	ROM_REGION( 0x800000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x800000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "bstar_v1.rom", 0x000000, 0x400000, 0x1b8d5bf7 )
 	ROM_LOAD( "bstar_v2.rom", 0x400000, 0x400000, 0x74cf0a70 )
 
@@ -4191,7 +4194,7 @@ ROM_START( rbff2 )
 
 	NEO_BIOS_SOUND_256K( "rb2_m1.rom", 0xed482791 )
 
-	ROM_REGION( 0x1000000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x1000000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "rb2_v1.rom", 0x000000, 0x400000, 0xf796265a )
 	ROM_LOAD( "rb2_v2.rom", 0x400000, 0x400000, 0x2cb3f3bb )
 	ROM_LOAD( "rb2_v3.rom", 0x800000, 0x400000, 0xdf77b7fa )
@@ -4217,7 +4220,7 @@ ROM_START( mslug2 )
 
 	NEO_BIOS_SOUND_128K( "ms2_m1.rom", 0x94520ebd )
 
-	ROM_REGION( 0x800000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x800000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "ms2_v1.rom", 0x000000, 0x400000, 0x99ec20e8 )
 	ROM_LOAD( "ms2_v2.rom", 0x400000, 0x400000, 0xecb16799 )
 
@@ -4241,7 +4244,7 @@ ROM_START( kof98 )
 
 	NEO_BIOS_SOUND_256K( "kof98_m1.rom", 0x4e7a6b1b )
 
-	ROM_REGION( 0x1000000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x1000000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "kof98_v1.rom", 0x000000, 0x400000, 0xb9ea8051 )
 	ROM_LOAD( "kof98_v2.rom", 0x400000, 0x400000, 0xcc11106e )
 	ROM_LOAD( "kof98_v3.rom", 0x800000, 0x400000, 0x044ea4e1 )
@@ -4269,7 +4272,7 @@ ROM_START( lastbld2 )
 
 	NEO_BIOS_SOUND_128K( "lb2_m1.rom", 0xacf12d10 )
 
-	ROM_REGION( 0x1000000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x1000000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "lb2_v1.rom", 0x000000, 0x400000, 0xf7ee6fbb )
 	ROM_LOAD( "lb2_v2.rom", 0x400000, 0x400000, 0xaa9e4df6 )
 	ROM_LOAD( "lb2_v3.rom", 0x800000, 0x400000, 0x4ac750b2 )
@@ -4295,7 +4298,7 @@ ROM_START( neocup98 )
 
 	NEO_BIOS_SOUND_128K( "nc98_m1.rom", 0xa701b276 )
 
-	ROM_REGION( 0x600000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x600000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "nc98_v1.rom", 0x000000, 0x400000, 0x79def46d )
 	ROM_LOAD( "nc98_v2.rom", 0x400000, 0x200000, 0xb231902f )
 
@@ -4315,7 +4318,7 @@ ROM_START( breakrev )
 
 	NEO_BIOS_SOUND_128K( "brev_m1.rom", 0x00f31c66 )
 
-	ROM_REGION(  0x800000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION(  0x800000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "brev_v1.rom", 0x000000, 0x400000, 0xe255446c )
 	ROM_LOAD( "brev_v2.rom", 0x400000, 0x400000, 0x9068198a )
 
@@ -4339,7 +4342,7 @@ ROM_START( shocktr2 )
 
 	NEO_BIOS_SOUND_128K( "st2_m1.rom", 0xd0604ad1 )
 
-	ROM_REGION( 0x1000000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x1000000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "st2_v1.rom", 0x000000, 0x400000, 0x16986fc6 )
 	ROM_LOAD( "st2_v2.rom", 0x400000, 0x400000, 0xada41e83 )
 	ROM_LOAD( "st2_v3.rom", 0x800000, 0x200000, 0xa05ba5db )
@@ -4363,7 +4366,7 @@ ROM_START( flipshot )
 
 	NEO_BIOS_SOUND_128K( "flip_m1.rom", 0xa9fe0144 )
 
-	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x200000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "flip_v1.rom", 0x000000, 0x200000, 0x42ec743d )
 
 	NO_DELTAT_REGION
@@ -4381,7 +4384,7 @@ ROM_START( pbobbl2n )
 
 	NEO_BIOS_SOUND_128K( "pb2_m1.rom", 0x883097a9 )
 
-	ROM_REGION( 0x800000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x800000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "pb2_v1.rom", 0x000000, 0x400000, 0x57fde1fa )
 	ROM_LOAD( "pb2_v2.rom", 0x400000, 0x400000, 0x4b966ef3 )
 
@@ -4403,7 +4406,7 @@ ROM_START( ctomaday )
 
 	NEO_BIOS_SOUND_128K( "ctom_m1.rom", 0x80328a47 )
 
-	ROM_REGION( 0x500000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x500000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "ctom_v1.rom", 0x000000, 0x400000, 0xde7c8f27 )
 	ROM_LOAD( "ctom_v2.rom", 0x400000, 0x100000, 0xc8e40119 )
 
@@ -4423,7 +4426,7 @@ ROM_START( mslugx )
 
 	NEO_BIOS_SOUND_128K( "msx_m1.rom", 0xfd42a842 )
 
-	ROM_REGION( 0xa00000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0xa00000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "msx_v1.rom", 0x000000, 0x400000, 0xc79ede73 )
 	ROM_LOAD( "msx_v2.rom", 0x400000, 0x400000, 0xea9aabe1 )
 	ROM_LOAD( "msx_v3.rom", 0x800000, 0x200000, 0x2ca65102 )
@@ -4448,7 +4451,7 @@ ROM_START( kof99 )
 
 	NEO_BIOS_SOUND_128K( "kof99_m1.rom", 0x5e74539c )
 
-	ROM_REGION( 0x0e00000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x0e00000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "kof99_v1.rom", 0x000000, 0x400000, 0xef2eecc8 )
 	ROM_LOAD( "kof99_v2.rom", 0x400000, 0x400000, 0x73e211ca )
 	ROM_LOAD( "kof99_v3.rom", 0x800000, 0x400000, 0x821901da )
@@ -4476,7 +4479,7 @@ ROM_START( garou )
 
 	NEO_BIOS_SOUND_256K( "motw_m1.rom", 0x00000000 )
 
-	ROM_REGION( 0x1000000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY )
+	ROM_REGION( 0x1000000, REGION_SOUND1 | REGIONFLAG_SOUNDONLY | REGIONFLAG_READONLY )
 	ROM_LOAD( "motw_v1.rom", 0x000000, 0x400000, 0x00000000 )
 	ROM_LOAD( "motw_v2.rom", 0x400000, 0x400000, 0x00000000 )
 	ROM_LOAD( "motw_v3.rom", 0x800000, 0x400000, 0x00000000 )
@@ -362,7 +362,8 @@ static void print_game_rom(FILE* out, const struct GameDriver* game) {
 			case REGION_USER8: fprintf(out, L2P "region user8" L2N); break;
 			default: fprintf(out, L2P "region 0x%x" L2N, region & ~REGIONFLAG_MASK);
             }
-			switch (region & REGIONFLAG_MASK)
+			/* REGIONFLAG_READONLY is only a loading hint */
+			switch (region & REGIONFLAG_MASK & ~REGIONFLAG_READONLY)
 			{
 			case 0:
 				break;
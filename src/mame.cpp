@@ -1,5 +1,6 @@
 #include <ctype.h>
 #include <stdarg.h>
+#include <zlib.h>
 #include "driver.h"
 #include "ui_text.h" /* LBO 042400 */
 #include "artwork.h"
@@ -261,7 +262,7 @@ void shutdown_machine(void)
 	for (i = 0;i < MAX_MEMORY_REGIONS;i++)
 	{
 		if (Machine->memory_region[i])
-			free(Machine->memory_region[i]);
+			release_memory_region(i);
 		Machine->memory_region[i] = 0;
 		Machine->memory_region_length[i] = 0;
 		Machine->memory_region_type[i] = 0;
@@ -339,6 +340,32 @@ static void scale_vectorgames(int gfx_width,int gfx_height,int *width,int *heigh
 }
 
 
+/* bump when decodegfx() output changes for the same input */
+#define GFXCACHE_FORMAT 1
+
+/* key for the decoded gfx cache: everything decodegfx() output depends on */
+static unsigned int gfxcache_key(int num,const struct GfxDecodeInfo *gdi,const struct GfxLayout *gl)
+{
+	UINT32 v[6];
+	uLong key;
+
+	v[0] = GFXCACHE_FORMAT;
+	v[1] = rom_crc_signature;
+	v[2] = num;
+	v[3] = gdi->memory_region;
+	v[4] = gdi->start;
+	v[5] = Machine->orientation;
+#ifdef PREROTATE_GFX
+	v[5] |= 0x80000000;
+#endif
+
+	key = crc32(0,(const Bytef *)Machine->gamedrv->name,strlen(Machine->gamedrv->name));
+	key = crc32(key,(const Bytef *)v,sizeof(v));
+	key = crc32(key,(const Bytef *)gl,sizeof(*gl));
+	return key;
+}
+
+
 static int vh_open(void)
 {
 	int i;
@@ -363,6 +390,7 @@ static int vh_open(void)
 		{
 			int reglen = 8*memory_region_length(drv->gfxdecodeinfo[i].memory_region);
 			struct GfxLayout glcopy;
+			unsigned int key;
 			int j;
 
 
@@ -392,9 +420,15 @@ static int vh_open(void)
 				}
 			}
 
-			if ((Machine->gfx[i] = decodegfx(memory_region(drv->gfxdecodeinfo[i].memory_region)
-					+ drv->gfxdecodeinfo[i].start,
-					&glcopy)) == 0)
+			key = gfxcache_key(i,&drv->gfxdecodeinfo[i],&glcopy);
+			if ((Machine->gfx[i] = osd_gfxcache_load(Machine->gamedrv->name,i,key)) == 0)
+			{
+				if ((Machine->gfx[i] = decodegfx(memory_region(drv->gfxdecodeinfo[i].memory_region)
+						+ drv->gfxdecodeinfo[i].start,
+						&glcopy)) != 0)
+					osd_gfxcache_save(Machine->gamedrv->name,i,key,Machine->gfx[i]);
+			}
+			if (Machine->gfx[i] == 0)
 			{
 				vh_close();
 
@@ -590,10 +624,11 @@ int run_machine(void)
 						int i;
 
 						/* invalidate contents to avoid subtle bugs */
-						for (i = 0;i < memory_region_length(region);i++)
-							memory_region(region)[i] = rand();
-						free(Machine->memory_region[region]);
-						Machine->memory_region[region] = 0;
+						/* (not file pages, that would just copy them all) */
+						if (!Machine->memory_region_mapped[region])
+							for (i = 0;i < memory_region_length(region);i++)
+								memory_region(region)[i] = rand();
+						release_memory_region(region);
 					}
 				}
 
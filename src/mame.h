@@ -22,6 +22,7 @@ struct RunningMachine
 	unsigned char *memory_region[MAX_MEMORY_REGIONS];
 	unsigned int memory_region_length[MAX_MEMORY_REGIONS];	/* some drivers might find this useful */
 	int memory_region_type[MAX_MEMORY_REGIONS];
+	int memory_region_mapped[MAX_MEMORY_REGIONS];	/* pages come from the ROM file, see osd_fmap() */
 	struct GfxElement *gfx[MAX_GFX_ELEMENTS];	/* graphic sets (chars, sprites) */
 	struct osd_bitmap *scrbitmap;	/* bitmap to draw into */
 	struct rectangle visible_area;
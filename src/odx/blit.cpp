@@ -21,28 +21,436 @@ extern int video_scale;
 //#define WHICH_BLIT 1
 
 UINT32 *palette_16bit_lookup;
+int palette_16bit_lookup_len;
 
-INLINE void blitscreen_color8_exact(struct osd_bitmap *bitmap)
+int render_thread = 0;	/* -renderthread: convert and present on another core */
+
+/* pixel conversion into the ARGB8888 texture, shared by the direct */
+/* blitters and the render thread. blit_init() swaps in a NEON or SSE2 */
+/* version of the RGB565 path. The palette paths stay scalar: neither can */
+/* gather, and a table lookup over byte planes of the palette costs one */
+/* shuffle per plane per 16 (SSSE3) or 32 (vtbx on ARMv7) entries. For a */
+/* 320x240 frame with 256 colours that measured 9x slower than this loop */
+/* with SSSE3, and 15x to 200x for palettized16's 256 to 4096 entries */
+
+static void convert_color8(const unsigned char *lb, int width, const UINT32 *palette,
+	unsigned int *address, int lines, int columns)
 {
-#ifdef WHICH_BLIT
-  printf("blitscreen_color8_exact\n");
-#endif  
 	int x, y;
-	int width=(bitmap->line[1] - bitmap->line[0]);
-	unsigned char *lb=bitmap->line[skiplines] + skipcolumns;
 
-  void *k; unsigned int pitch; COL_LockTexture(colRenderer, &k, &pitch);
+	for (y = 0; y < lines; ++y)
+	{
+		for (x = 0; x < columns; ++x)
+		{
+			*(address++) = palette[*(lb + x)];
+		}
+		lb += width;
+	}
+}
 
-	register unsigned int *address=(unsigned int *)k;
+static void convert_palettized16(const unsigned short *lb, int width, const UINT32 *palette,
+	unsigned int *address, int lines, int columns)
+{
+	int x, y;
 
-	for (y = 0; y < gfx_display_lines; ++y)
+	for (y = 0; y < lines; ++y)
 	{
-		for (x = 0; x < gfx_display_columns; ++x)
+		for (x = 0; x < columns; ++x)
 		{
-			*(address++) = odx_palette_rgb[*(lb + x)];
-    }
+			*(address++) =  palette[*(lb + x)];
+		}
 		lb += width;
 	}
+}
+
+static void convert_color16_c(const unsigned short *lb, int width, const UINT32 *palette,
+	unsigned int *address, int lines, int columns)
+{
+	int x, y;
+
+	for (y = 0; y < lines; ++y)
+	{
+		for (x = 0; x < columns; ++x)
+		{
+			unsigned int c = (unsigned int)lb[x];
+			*(address++) =  ((c&0xF800)<<8) | ((c&0x7e0)<<5) | ((c&0x1f)<<3) | 0xff000000  ;
+		}
+		lb += width;
+	}
+}
+
+/* 32-bit ARM only with -mfpu=neon, the makefile.ct default */
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define BLIT_SIMD "NEON"
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define BLIT_SIMD "SSE2"
+#endif
+
+#ifdef BLIT_SIMD
+
+/* RGB565 -> ARGB8888, eight pixels per step, same bits as the _c version */
+static void convert_color16_simd(const unsigned short *lb, int width, const UINT32 *palette,
+	unsigned int *address, int lines, int columns)
+{
+	int x, y;
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+	const uint32x4_t mr = vdupq_n_u32(0xF800), mg = vdupq_n_u32(0x7e0), mb = vdupq_n_u32(0x1f);
+	const uint32x4_t alpha = vdupq_n_u32(0xff000000);
+#else
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i mr = _mm_set1_epi32(0xF800), mg = _mm_set1_epi32(0x7e0), mb = _mm_set1_epi32(0x1f);
+	const __m128i alpha = _mm_set1_epi32((int)0xff000000);
+#endif
+
+	for (y = 0; y < lines; ++y)
+	{
+		for (x = 0; x + 8 <= columns; x += 8)
+		{
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+			uint16x8_t c = vld1q_u16(lb + x);
+			uint32x4_t c0 = vmovl_u16(vget_low_u16(c));
+			uint32x4_t c1 = vmovl_u16(vget_high_u16(c));
+			c0 = vorrq_u32(vorrq_u32(vshlq_n_u32(vandq_u32(c0, mr), 8), vshlq_n_u32(vandq_u32(c0, mg), 5)),
+				vorrq_u32(vshlq_n_u32(vandq_u32(c0, mb), 3), alpha));
+			c1 = vorrq_u32(vorrq_u32(vshlq_n_u32(vandq_u32(c1, mr), 8), vshlq_n_u32(vandq_u32(c1, mg), 5)),
+				vorrq_u32(vshlq_n_u32(vandq_u32(c1, mb), 3), alpha));
+			vst1q_u32((uint32_t *)address, c0);
+			vst1q_u32((uint32_t *)address + 4, c1);
+#else
+			__m128i c = _mm_loadu_si128((const __m128i *)(lb + x));
+			__m128i c0 = _mm_unpacklo_epi16(c, zero);
+			__m128i c1 = _mm_unpackhi_epi16(c, zero);
+			c0 = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(_mm_and_si128(c0, mr), 8), _mm_slli_epi32(_mm_and_si128(c0, mg), 5)),
+				_mm_or_si128(_mm_slli_epi32(_mm_and_si128(c0, mb), 3), alpha));
+			c1 = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(_mm_and_si128(c1, mr), 8), _mm_slli_epi32(_mm_and_si128(c1, mg), 5)),
+				_mm_or_si128(_mm_slli_epi32(_mm_and_si128(c1, mb), 3), alpha));
+			_mm_storeu_si128((__m128i *)address, c0);
+			_mm_storeu_si128((__m128i *)address + 1, c1);
+#endif
+			address += 8;
+		}
+		for (; x < columns; ++x)
+		{
+			unsigned int c = (unsigned int)lb[x];
+			*(address++) =  ((c&0xF800)<<8) | ((c&0x7e0)<<5) | ((c&0x1f)<<3) | 0xff000000  ;
+		}
+		lb += width;
+	}
+}
+
+#endif /* BLIT_SIMD */
+
+typedef void (*convert16_func)(const unsigned short *, int, const UINT32 *, unsigned int *, int, int);
+
+static convert16_func convert_color16 = convert_color16_c;
+
+void blit_init(void)
+{
+	convert_color16 = convert_color16_c;
+#ifdef BLIT_SIMD
+	if (osd_cpu_has_simd())
+	{
+		convert_color16 = convert_color16_simd;
+		printf("Blitters: %s\n", BLIT_SIMD);
+		return;
+	}
+#endif
+	printf("Blitters: scalar\n");
+}
+
+/***************************************************************************
+
+  Render thread. The emulation thread only snapshots the visible area and
+  the palette; the snapshot is converted, flushed and presented on another
+  core into the texture's rotating buffers. Three snapshot slots are
+  passed around by pointer (fill -> pending -> work), so neither side ever
+  waits for the other; a frame still pending when the next one arrives is
+  dropped.
+
+***************************************************************************/
+
+enum { BLIT_COLOR8, BLIT_PALETTIZED16, BLIT_COLOR16 };
+
+struct blit_snapshot
+{
+	int kind;
+	int lines, columns;
+	unsigned char *pixels;
+	int pixels_size;
+	UINT32 *palette;
+	int palette_size;
+};
+
+static struct blit_snapshot blit_slots[3];
+static struct blit_snapshot *blit_fill, *blit_pending, *blit_work;
+static int blit_pending_fresh;
+static int blit_quit;
+static SDL_Thread *blit_thread;
+static SDL_mutex *blit_lock;
+static SDL_cond *blit_cond;
+
+static void blit_convert_snapshot(const struct blit_snapshot *s)
+{
+	void *k; unsigned int pitch; COL_LockTexture(colRenderer, &k, &pitch);
+	unsigned int *address=(unsigned int *)k;
+
+	switch (s->kind)
+	{
+		case BLIT_COLOR8:
+			convert_color8(s->pixels, s->columns, s->palette, address, s->lines, s->columns);
+			break;
+		case BLIT_PALETTIZED16:
+			convert_palettized16((unsigned short *)s->pixels, s->columns, s->palette, address, s->lines, s->columns);
+			break;
+		case BLIT_COLOR16:
+			convert_color16((unsigned short *)s->pixels, s->columns, 0, address, s->lines, s->columns);
+			break;
+	}
+
+	COL_UnlockTexture(colRenderer);
+	FLIP_VIDEO
+}
+
+static int blit_thread_func(void *data)
+{
+	SDL_LockMutex(blit_lock);
+	for (;;)
+	{
+		struct blit_snapshot *tmp;
+
+		while (!blit_pending_fresh && !blit_quit)
+			SDL_CondWait(blit_cond, blit_lock);
+		if (blit_quit) break;
+
+		tmp = blit_work; blit_work = blit_pending; blit_pending = tmp;
+		blit_pending_fresh = 0;
+		SDL_UnlockMutex(blit_lock);
+
+		blit_convert_snapshot(blit_work);
+
+		SDL_LockMutex(blit_lock);
+	}
+	SDL_UnlockMutex(blit_lock);
+	return 0;
+}
+
+static int blit_thread_start(void)
+{
+	blit_fill = &blit_slots[0];
+	blit_pending = &blit_slots[1];
+	blit_work = &blit_slots[2];
+	blit_pending_fresh = 0;
+	blit_quit = 0;
+
+	blit_lock = SDL_CreateMutex();
+	blit_cond = SDL_CreateCond();
+	if (blit_lock) blit_thread = SDL_CreateThread(blit_thread_func, "blit", 0);
+
+	if (!blit_thread)
+	{
+		printf("Unable to start render thread, blitting inline\n");
+		if (blit_cond) SDL_DestroyCond(blit_cond);
+		if (blit_lock) SDL_DestroyMutex(blit_lock);
+		blit_cond = 0;
+		blit_lock = 0;
+		render_thread = 0;
+		return 1;
+	}
+	printf("Render thread started\n");
+	return 0;
+}
+
+void blit_thread_stop(void)
+{
+	int i;
+
+	if (!blit_thread) return;
+
+	SDL_LockMutex(blit_lock);
+	blit_quit = 1;
+	SDL_CondSignal(blit_cond);
+	SDL_UnlockMutex(blit_lock);
+	SDL_WaitThread(blit_thread, 0);
+	blit_thread = 0;
+
+	SDL_DestroyCond(blit_cond);
+	SDL_DestroyMutex(blit_lock);
+	blit_cond = 0;
+	blit_lock = 0;
+
+	for (i = 0; i < 3; i++)
+	{
+		free(blit_slots[i].pixels);
+		free(blit_slots[i].palette);
+		memset(&blit_slots[i], 0, sizeof(blit_slots[i]));
+	}
+}
+
+/* the render thread is gone after this, the caller blits inline */
+static void blit_submit_failed(const char *what, int size)
+{
+	logerror("Render thread: unable to allocate %d bytes for the %s, blitting inline\n", size, what);
+	blit_thread_stop();
+	render_thread = 0;
+}
+
+/* copy the visible area and palette into the fill slot and hand it over */
+static void blit_submit(int kind, struct osd_bitmap *bitmap, const UINT32 *palette, int palette_len)
+{
+	struct blit_snapshot *s, *tmp;
+	int bpp = (kind == BLIT_COLOR8) ? 1 : 2;
+	int size = gfx_display_lines * gfx_display_columns * bpp;
+	int y;
+
+	if (!blit_thread && blit_thread_start()) return;
+
+	s = blit_fill;
+	if (s->pixels_size < size)
+	{
+		free(s->pixels);
+		s->pixels = (unsigned char *)malloc(size);
+		s->pixels_size = s->pixels ? size : 0;
+		if (!s->pixels)
+		{
+			blit_submit_failed("frame", size);
+			return;
+		}
+	}
+	if (palette && s->palette_size < palette_len)
+	{
+		free(s->palette);
+		s->palette = (UINT32 *)malloc(palette_len * sizeof(UINT32));
+		s->palette_size = s->palette ? palette_len : 0;
+		if (!s->palette)
+		{
+			blit_submit_failed("palette", palette_len * sizeof(UINT32));
+			return;
+		}
+	}
+
+	s->kind = kind;
+	s->lines = gfx_display_lines;
+	s->columns = gfx_display_columns;
+	for (y = 0; y < gfx_display_lines; y++)
+		memcpy(s->pixels + y * gfx_display_columns * bpp,
+				bitmap->line[skiplines + y] + skipcolumns * bpp,
+				gfx_display_columns * bpp);
+	if (palette)
+		memcpy(s->palette, palette, palette_len * sizeof(UINT32));
+
+	SDL_LockMutex(blit_lock);
+	tmp = blit_pending; blit_pending = blit_fill; blit_fill = tmp;
+	blit_pending_fresh = 1;
+	SDL_CondSignal(blit_cond);
+	SDL_UnlockMutex(blit_lock);
+}
+
+/***************************************************************************
+
+  Dirty mode (VIDEO_SUPPORTS_DIRTY). osd_mark_dirty() flags 16x16 cells of
+  the visible area; ISDIRTY also covers the previous frame's cells, which
+  is where sprites were erased. The texture rotates through
+  COL_TEXTURE_BUFFER_COUNT buffers, so each cell remembers the frame it
+  last changed in and each buffer the frame it was last written in. Only
+  cells that changed since the buffer was last written are converted, the
+  rest already hold the right pixels and are carried over untouched.
+
+***************************************************************************/
+
+static unsigned int dirty_frame;
+static unsigned int dirty_cell_frame[DIRTY_V * DIRTY_H];
+static unsigned int dirty_buffer_frame[COL_TEXTURE_BUFFER_COUNT];
+static COL_Texture *dirty_texture;
+
+static void blitscreen_dirty(struct osd_bitmap *bitmap, int kind)
+{
+	COL_Texture *texture = colRenderer->texture;
+	int bpp = (kind == BLIT_COLOR8) ? 1 : 2;
+	int width = (bitmap->line[1] - bitmap->line[0]) / bpp;
+	int cells_x = (gfx_display_columns + 15) / 16;
+	int cells_y = (gfx_display_lines + 15) / 16;
+	unsigned int since;
+	int cx, cy, x0, y0, w, h, y;
+
+	if (texture != dirty_texture)
+	{
+		/* new texture, none of its buffers can be trusted */
+		dirty_texture = texture;
+		memset(dirty_buffer_frame, 0, sizeof(dirty_buffer_frame));
+	}
+	dirty_frame++;
+	since = dirty_buffer_frame[texture->current_buffer];
+
+	void *k; unsigned int pitch; COL_LockTexture(colRenderer, &k, &pitch);
+
+	for (cy = 0; cy < cells_y; cy++)
+	{
+		unsigned int *stamp = dirty_cell_frame + cy * DIRTY_H;
+
+		y0 = cy * 16;
+		h = gfx_display_lines - y0;
+		if (h > 16) h = 16;
+
+		for (cx = 0; cx < cells_x; cx++)
+			if (ISDIRTY(cx * 16, y0)) stamp[cx] = dirty_frame;
+
+		cx = 0;
+		while (cx < cells_x)
+		{
+			if (since && stamp[cx] <= since) { cx++; continue; }
+
+			/* convert a run of neighbouring stale cells in one go */
+			x0 = cx * 16;
+			while (cx < cells_x && (!since || stamp[cx] > since)) cx++;
+			w = cx * 16;
+			if (w > gfx_display_columns) w = gfx_display_columns;
+			w -= x0;
+
+			for (y = y0; y < y0 + h; y++)
+			{
+				unsigned int *address = (unsigned int *)k + y * pitch + x0;
+				unsigned char *lb = bitmap->line[skiplines + y] + (skipcolumns + x0) * bpp;
+
+				switch (kind)
+				{
+					case BLIT_COLOR8:
+						convert_color8(lb, width, odx_palette_rgb, address, 1, w);
+						break;
+					case BLIT_PALETTIZED16:
+						convert_palettized16((unsigned short *)lb, width, palette_16bit_lookup, address, 1, w);
+						break;
+					case BLIT_COLOR16:
+						convert_color16((unsigned short *)lb, width, 0, address, 1, w);
+						break;
+				}
+			}
+		}
+	}
+	dirty_buffer_frame[texture->current_buffer] = dirty_frame;
+
+	COL_UnlockTexture(colRenderer);
+	FLIP_VIDEO
+}
+
+INLINE void blitscreen_color8_exact(struct osd_bitmap *bitmap)
+{
+#ifdef WHICH_BLIT
+  printf("blitscreen_color8_exact\n");
+#endif
+	if (render_thread)
+	{
+		blit_submit(BLIT_COLOR8, bitmap, odx_palette_rgb, 256);
+		if (render_thread) return;
+	}
+
+	int width=(bitmap->line[1] - bitmap->line[0]);
+	unsigned char *lb=bitmap->line[skiplines] + skipcolumns;
+
+  void *k; unsigned int pitch; COL_LockTexture(colRenderer, &k, &pitch);
+
+	convert_color8(lb, width, odx_palette_rgb, (unsigned int *)k, gfx_display_lines, gfx_display_columns);
 
 	COL_UnlockTexture(colRenderer);
 	FLIP_VIDEO
@@ -50,7 +458,10 @@ INLINE void blitscreen_color8_exact(struct osd_bitmap *bitmap)
 
 void blitscreen_dirty1_color8(struct osd_bitmap *bitmap)
 {
-  blitscreen_color8_exact(bitmap);
+	if (render_thread)
+		blitscreen_color8_exact(bitmap);
+	else
+		blitscreen_dirty(bitmap, BLIT_COLOR8);
 }
 
 void blitscreen_dirty0_color8(struct osd_bitmap *bitmap)
@@ -60,71 +471,70 @@ void blitscreen_dirty0_color8(struct osd_bitmap *bitmap)
 
 INLINE void blitscreen_palettized16_exact(struct osd_bitmap *bitmap)
 {
-#ifdef WHICH_BLIT  
+#ifdef WHICH_BLIT
   printf("blitscreen_palettized16_exact\n");
-#endif  
-	int x, y;
+#endif
+	if (render_thread)
+	{
+		blit_submit(BLIT_PALETTIZED16, bitmap, palette_16bit_lookup, palette_16bit_lookup_len);
+		if (render_thread) return;
+	}
+
 	int width=(bitmap->line[1] - bitmap->line[0])>>1;
 	unsigned short *lb=((unsigned short*)(bitmap->line[skiplines])) + skipcolumns;
 
   void *k; unsigned int pitch; COL_LockTexture(colRenderer, &k, &pitch);
-	register unsigned int *address=(unsigned int *)k;
 
-	for (y = 0; y < gfx_display_lines; ++y)
-	{
-		for (x = 0; x < gfx_display_columns; ++x)
-		{
-			*(address++) =  palette_16bit_lookup[*(lb + x)];  
-    }
-		lb += width;
-	}
+	convert_palettized16(lb, width, palette_16bit_lookup, (unsigned int *)k, gfx_display_lines, gfx_display_columns);
 
 	COL_UnlockTexture(colRenderer);
-	FLIP_VIDEO   
+	FLIP_VIDEO
 }
 
 void blitscreen_dirty0_palettized16(struct osd_bitmap *bitmap)
 {
-  blitscreen_palettized16_exact(bitmap); 
+  blitscreen_palettized16_exact(bitmap);
 }
 
 void blitscreen_dirty1_palettized16(struct osd_bitmap *bitmap)
 {
-  blitscreen_palettized16_exact(bitmap); 
+	if (render_thread)
+		blitscreen_palettized16_exact(bitmap);
+	else
+		blitscreen_dirty(bitmap, BLIT_PALETTIZED16);
 }
 
 INLINE void blitscreen_color16_exact(struct osd_bitmap *bitmap)
 {
-#ifdef WHICH_BLIT  
+#ifdef WHICH_BLIT
   printf("blitscreen_color16_exact\n");
 #endif
-	int x, y;
+	if (render_thread)
+	{
+		blit_submit(BLIT_COLOR16, bitmap, 0, 0);
+		if (render_thread) return;
+	}
+
 	int width=(bitmap->line[1] - bitmap->line[0])>>1;
 	unsigned short *lb=((unsigned short*)(bitmap->line[skiplines])) + skipcolumns;
 
   void *k; unsigned int pitch; COL_LockTexture(colRenderer, &k, &pitch);
-	register unsigned int *address=(unsigned int *)k;
-  
-	for (y = 0; y < gfx_display_lines; ++y)
-	{
-		for (x = 0; x < gfx_display_columns; ++x)
-		{
-      unsigned int c = (unsigned int)lb[x];
-			*(address++) =  ((c&0xF800)<<8) | ((c&0x7e0)<<5) | ((c&0x1f)<<3) | 0xff000000  ;
-    }
-		lb += width;
-	}
+
+	convert_color16(lb, width, 0, (unsigned int *)k, gfx_display_lines, gfx_display_columns);
 
 	COL_UnlockTexture(colRenderer);
-	FLIP_VIDEO   
+	FLIP_VIDEO
 }
 
 void blitscreen_dirty0_color16(struct osd_bitmap *bitmap)
 {
-  blitscreen_color16_exact(bitmap); 
+  blitscreen_color16_exact(bitmap);
 }
 
 void blitscreen_dirty1_color16(struct osd_bitmap *bitmap)
 {
-  blitscreen_color16_exact(bitmap); 
+	if (render_thread)
+		blitscreen_color16_exact(bitmap);
+	else
+		blitscreen_dirty(bitmap, BLIT_COLOR16);
 }
@@ -11,17 +11,18 @@ extern "C" {
 #define SDL_malloc malloc
 
 static
-COL_Texture* COL_TextureCreate(const unsigned int w, const unsigned int h, unsigned int d) {
+COL_Texture* COL_TextureCreate(const unsigned int w, const unsigned int h, unsigned int d, const int headless) {
   COL_Texture *const texture = (COL_Texture *) SDL_calloc(1, sizeof(*texture));
   const unsigned int s = w*h*d;
   texture->w = w;
   texture->h = h;
+  texture->headless = headless;
   texture->buffer_size = s;
   texture->buffer_count = COL_TEXTURE_BUFFER_COUNT;
   texture->current_buffer = 0;
   int i;
   for(i=0; i<texture->buffer_count; ++i){
-    texture->buffers[i] = (uint8_t*)ve_malloc(s);
+    texture->buffers[i] = headless ? (uint8_t*)SDL_malloc(s) : (uint8_t*)ve_malloc(s);
     memset(texture->buffers[i], 0, s);
   }
   return texture;
@@ -31,7 +32,8 @@ static
 void COL_TextureFree(COL_Texture *const texture) {
   int i;
   for(i=0; i<texture->buffer_count; ++i){
-    ve_free(texture->buffers[i]);
+    if(texture->headless) SDL_free(texture->buffers[i]);
+    else ve_free(texture->buffers[i]);
   } 
   SDL_free(texture);
 }
@@ -40,7 +42,7 @@ static
 void COL_TexturePresent(COL_Texture *const texture) {
   uint8_t *const buffer = texture->buffers[texture->current_buffer];
 //  disp_wait_for_frame();    
-  disp_new_frame(ve_virt2phys(buffer), ve_virt2phys(0), 0);
+  if(!texture->headless) disp_new_frame(ve_virt2phys(buffer), ve_virt2phys(0), 0);
   texture->current_buffer = (texture->current_buffer+1)%texture->buffer_count;
 }
 
@@ -63,6 +65,7 @@ void COL_TextureClear(COL_Texture *const texture) {
 }
 
 void COL_updateWindowPosition(COL_Renderer * renderer, const int x, const unsigned int y, const unsigned int w, const int h) {
+  if(renderer->headless) return;
   disp_set_dest(x,y,w,h);
 }
 
@@ -71,6 +74,7 @@ void COL_RendererClear(COL_Renderer *const renderer) {
 }
 
 void COL_TextureFlush(COL_Texture *const texture){
+  if(texture->headless) return;
   ve_flush_cache(COL_TextureGetPixels(texture), texture->buffer_size);
 }
 
@@ -82,9 +86,9 @@ COL_CreateTexture(COL_Renderer * renderer,
   printf("COL_CreateTexture(const unsigned int tw %d, const unsigned int th %d, const int x %d, const unsigned int y %d, const unsigned int w %d, const unsigned int h %d)\n",
   tw,th,x,y,w,h);
   
-  COL_Texture *col_texture = COL_TextureCreate(tw,th, 4);
+  COL_Texture *col_texture = COL_TextureCreate(tw,th, 4, renderer->headless);
   
-	disp_set_para(ve_virt2phys(COL_TextureGetPixels(col_texture)), 0,	COLOR_ARGB8888, tw, th, 0, 0, tw, th, x, y, w, h);
+	if(!renderer->headless) disp_set_para(ve_virt2phys(COL_TextureGetPixels(col_texture)), 0,	COLOR_ARGB8888, tw, th, 0, 0, tw, th, x, y, w, h);
 
   if( renderer->texture) {  
     COL_TextureFree( renderer->texture);
@@ -140,7 +144,7 @@ COL_DestroyTexture(COL_Renderer * renderer)
 {
   COL_Texture *const col_texture = renderer->texture;
   if(col_texture) {  
-    disp_close();
+    if(!renderer->headless) disp_close();
     COL_TextureFree(col_texture);
     renderer->texture = 0;
   }
@@ -150,6 +154,11 @@ void
 COL_DestroyRenderer(COL_Renderer * renderer)
 {
   if(renderer) {
+    if(renderer->headless) {
+      COL_DestroyTexture(renderer);
+      SDL_free(renderer);
+      return;
+    }
     disp_close();  
     COL_DestroyTexture(renderer);
     ve_close();
@@ -186,3 +195,22 @@ COL_Renderer *COL_CreateRenderer()
 
   return col_renderer;
 }  
+
+/* Renderer for machines without /dev/disp or the VE driver (regression and */
+/* perf farms). Textures live in plain heap buffers and are never displayed. */
+COL_Renderer *COL_CreateHeadlessRenderer()
+{
+  COL_Renderer *col_renderer;
+  
+  col_renderer = (COL_Renderer *) SDL_calloc(1, sizeof(*col_renderer));
+  
+  if(!col_renderer) {
+      SDL_OutOfMemory();
+      return NULL;    
+  }
+
+  col_renderer->texture = NULL;
+  col_renderer->headless = 1;
+
+  return col_renderer;
+}
@@ -9,12 +9,14 @@ typedef struct COL_Texture {
   unsigned int current_buffer;
   unsigned int w;
   unsigned int h;
+  int headless;
   uint8_t* buffers[COL_TEXTURE_BUFFER_COUNT];
   
 } COL_Texture;
 
 typedef struct COL_Renderer {
   COL_Texture *texture;
+  int headless;       /* heap buffers only, no /dev/disp or VE */
 } COL_Renderer;
 
 
@@ -28,6 +30,7 @@ void COL_RenderCopyAndPresent(COL_Renderer *const renderer);
 void COL_DestroyTexture(COL_Renderer * renderer);
 void COL_DestroyRenderer(COL_Renderer * renderer);
 COL_Renderer *COL_CreateRenderer();
+COL_Renderer *COL_CreateHeadlessRenderer();
 void COL_updateWindowPosition(COL_Renderer * renderer, const int x, const unsigned int y, const unsigned int w, const int h);
 void COL_GetTextureSize(COL_Renderer * renderer, unsigned int *w, unsigned int *h);
 void COL_RendererClear(COL_Renderer *const renderer);
@@ -36,6 +36,10 @@ extern char *nvdir, *hidir, *cfgdir, *inpdir, *stadir, *memcarddir;
 extern char *artworkdir, *screenshotdir, *alternate_name;
 
 extern char *cheatdir;
+extern char *gfxcachedir;
+
+/* from gfxcache.c */
+extern int gfxcache_enable;
 
 extern char mdir[512];
 
@@ -321,6 +325,8 @@ void parse_cmdline (int argc, char **argv, int game_index)
 	memcarddir = get_string ("directory", "memcard", NULL, "memcard");
 	stadir     = get_string ("directory", "sta",     NULL, "sta");
 	artworkdir = get_string ("directory", "artwork", NULL, "artwork");
+	gfxcachedir = get_string ("directory", "gfxcache", NULL, "gfxcache");
+	gfxcache_enable = get_bool ("config", "gfxcache", NULL, 1);
 
 	cheatdir = get_string ("directory", "cheat", NULL, ".");
 
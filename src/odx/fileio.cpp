@@ -2,6 +2,8 @@
 #include "unzip.h"
 #include "zlib.h"
 #include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
 #include <unistd.h>
 #include <signal.h>
 
@@ -28,6 +30,7 @@ int samplepathc = 0;
 char *cfgdir, *nvdir, *hidir, *inpdir, *stadir;
 char *memcarddir, *artworkdir, *screenshotdir;
 char *cheatdir;	/* Steph */
+char *gfxcachedir;
 
 char mdir[512]; /* Alek */
 
@@ -48,10 +51,15 @@ typedef struct
 	unsigned int length;
 	eFileType type;
 	unsigned int crc;
+	char *path;			/* ROM not read yet: file, or zip holding ent */
+	struct zipent ent;
+	int borrowed;		/* data was given to osd_fload() or osd_fmap(), don't free it */
+	int mapped;			/* data is the file's pages, munmap() it */
 }	FakeFileHandle;
 
 //extern unsigned int crc32 (unsigned int crc, const unsigned char *buf, unsigned int len);
 static int checksum_file (const char *file, unsigned char **p, unsigned int *size, unsigned int *crc);
+static int fake_load (FakeFileHandle *f, unsigned char *dest);
 
 /*
  * File stat cache LRU (Last Recently Used)
@@ -384,11 +392,14 @@ void *osd_fopen (const char *game, const char *filename, int filetype, int _writ
 					sprintf (name, "%s/%s/%s", dir_name, gamename, filename);
 					if( filetype == OSD_FILETYPE_ROM )
 					{
-						if( checksum_file (name, &f->data, &f->length, &f->crc) == 0 )
+						/* read later by osd_fload() or the first access */
+						if( cache_stat (name, &stat_buffer) == 0 && S_ISREG(stat_buffer.st_mode) )
 						{
 							f->type = kRAMFile;
 							f->offset = 0;
-							found = 1;
+							f->length = stat_buffer.st_size;
+							f->path = strdup (name);
+							found = f->path != 0;
 						}
 					}
 					else
@@ -407,7 +418,20 @@ void *osd_fopen (const char *game, const char *filename, int filetype, int _writ
 				LOG(("Trying %s file\n", name));
                 if( cache_stat (name, &stat_buffer) == 0 )
 				{
-					if( load_zipped_file (name, filename, &f->data, &f->length) == 0 )
+					if( filetype == OSD_FILETYPE_ROM )
+					{
+						/* read later by osd_fload() or the first access */
+						if( locate_zipped_file (name, filename, &f->ent) == 0 )
+						{
+							LOG(("Using (osd_fopen) zip file for %s\n", filename));
+							f->type = kZippedFile;
+							f->offset = 0;
+							f->length = f->ent.uncompressed_size;
+							f->path = strdup (name);
+							found = f->path != 0;
+						}
+					}
+					else if( load_zipped_file (name, filename, &f->data, &f->length) == 0 )
 					{
 						LOG(("Using (osd_fopen) zip file for %s\n", filename));
 						f->type = kZippedFile;
@@ -428,11 +452,13 @@ void *osd_fopen (const char *game, const char *filename, int filetype, int _writ
 					sprintf (name, "%s/%s.zip/%s", dir_name, gamename, filename);
 					if( filetype == OSD_FILETYPE_ROM )
 					{
-						if( checksum_file (name, &f->data, &f->length, &f->crc) == 0 )
+						if( cache_stat (name, &stat_buffer) == 0 && S_ISREG(stat_buffer.st_mode) )
 						{
 							f->type = kRAMFile;
 							f->offset = 0;
-							found = 1;
+							f->length = stat_buffer.st_size;
+							f->path = strdup (name);
+							found = f->path != 0;
 						}
 					}
 					else
@@ -746,6 +772,13 @@ void *osd_fopen (const char *game, const char *filename, int filetype, int _writ
 
 		break;
 
+	case OSD_FILETYPE_IDLE:
+		sprintf (name, "%s%s/%s.idl", mdir, cfgdir, gamename);
+		f->type = kPlainFile;
+		f->file = fopen (name, _write ? "wb" : "rb");
+		found = f->file != 0;
+		break;
+
 	case OSD_FILETYPE_INPUTLOG:
 		sprintf (name, "%s%s/%s.inp", mdir, inpdir, gamename);
 		f->type = kPlainFile;
@@ -916,11 +949,15 @@ int osd_fread (void *file, void *buffer, int length)
 	case kZippedFile:
 	case kRAMFile:
 		/* reading from the RAM image of a file */
+		if( f->path )
+			fake_load (f, 0);
 		if( f->data )
 		{
 			if( length + f->offset > f->length )
 				length = f->length - f->offset;
-			memcpy (buffer, f->offset + f->data, length);
+			/* osd_fload() may have put the data right where it is wanted */
+			if( buffer != f->offset + f->data )
+				memcpy (buffer, f->offset + f->data, length);
 			f->offset += length;
 			return length;
 		}
@@ -1026,6 +1063,8 @@ int osd_fread_scatter (void *file, void *buffer, int length, int increment)
 	case kZippedFile:
 	case kRAMFile:
 		/* reading from the RAM image of a file */
+		if( f->path )
+			fake_load (f, 0);
 		if( f->data )
 		{
 			if( length + f->offset > f->length )
@@ -1090,8 +1129,14 @@ void osd_fclose (void *file)
 		break;
 	case kZippedFile:
 	case kRAMFile:
-		if( f->data )
-			free(f->data);
+		if( f->data && !f->borrowed )
+		{
+			if( f->mapped )
+				munmap (f->data, f->length);
+			else
+				free(f->data);
+		}
+		free(f->path);
 		break;
 	}
 	free(f);
@@ -1250,9 +1295,130 @@ unsigned int osd_fcrc (void *file)
 {
 	FakeFileHandle *f = (FakeFileHandle *) file;
 
+	if( f->path )
+		fake_load (f, 0);
 	return f->crc;
 }
 
+/* Read a ROM osd_fopen() only located, into dest if given (osd_fsize() */
+/* bytes) or a buffer of its own, checksumming it on the way. Called from */
+/* worker threads, so it only touches f. */
+static int fake_load (FakeFileHandle *f, unsigned char *dest)
+{
+	unsigned char *data = dest;
+	int err;
+
+	/* plain files are used straight from the page cache, not copied */
+	if( f->type == kRAMFile && !data && f->length )
+	{
+		if( !f->data && osd_fmap (f) )
+		{
+			/* our own mapping this time, not the caller's */
+			f->borrowed = 0;
+			f->mapped = 1;
+		}
+		if( f->data )
+		{
+			f->crc = crc32 (0L, f->data, f->length);
+			free(f->path);
+			f->path = 0;
+			return 0;
+		}
+	}
+
+	if( !data && (data = (unsigned char *) malloc(f->length ? f->length : 1)) == 0 )
+		err = -1;
+	else if( f->type == kZippedFile )
+		err = read_zipped_entry (f->path, &f->ent, data, &f->crc);
+	else
+	{
+		FILE *fp = fopen (f->path, "rb");
+
+		err = -1;
+		if( fp )
+		{
+			if( f->length == 0 || fread (data, f->length, 1, fp) == 1 )
+			{
+				f->crc = crc32 (0L, data, f->length);
+				err = 0;
+			}
+			fclose (fp);
+		}
+	}
+
+	if( err )
+	{
+		logerror("fake_load: unable to read %s\n", f->path);
+		if( data != dest )
+			free(data);
+		data = 0;
+		f->length = 0;
+	}
+
+	f->data = data;
+	f->borrowed = data && data == dest;
+	free(f->path);
+	f->path = 0;
+	return err;
+}
+
+struct fload_job
+{
+	void **files;
+	unsigned char **dest;
+};
+
+static void fload_range (void *param, int start, int end)
+{
+	struct fload_job *job = (struct fload_job *) param;
+	int i;
+
+	for( i = start; i < end; i++ )
+	{
+		FakeFileHandle *f = (FakeFileHandle *) job->files[i];
+
+		if( f && f->path )
+			fake_load (f, job->dest ? job->dest[i] : 0);
+	}
+}
+
+void *osd_fmap (void *file)
+{
+	FakeFileHandle *f = (FakeFileHandle *) file;
+	void *base;
+	int fd;
+
+	/* only files in a directory that haven't been read yet */
+	if( f->type != kRAMFile || !f->path || f->data || !f->length )
+		return 0;
+
+	if( (fd = open (f->path, O_RDONLY)) < 0 )
+		return 0;
+	base = mmap (0, f->length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	close (fd);
+	if( base == MAP_FAILED )
+		return 0;
+
+	/* the checksum is still left to osd_fload() */
+	f->data = (unsigned char *) base;
+	f->borrowed = 1;
+	return base;
+}
+
+void osd_funmap (void *base, int length)
+{
+	munmap (base, length);
+}
+
+void osd_fload (void **files, unsigned char **dest, int count)
+{
+	struct fload_job job;
+
+	job.files = files;
+	job.dest = dest;
+	osd_parallel_for (count, fload_range, &job);
+}
+
 int osd_fgetc(void *file)
 {
 	FakeFileHandle *f = (FakeFileHandle *) file;
@@ -307,13 +307,13 @@ enum { LIST_LIST = 1, LIST_LISTINFO, LIST_LISTFULL, LIST_LISTSAMDIR, LIST_LISTRO
 		LIST_LMR, LIST_LISTDETAILS, LIST_GAMELISTHEADER, LIST_GAMELISTFOOTER, LIST_GAMELIST,
 		LIST_LISTGAMES, LIST_LISTCLONES,
 		LIST_WRONGORIENTATION, LIST_WRONGFPS, LIST_LISTCRC, LIST_LISTDUPCRC, LIST_WRONGMERGE,
-		LIST_LISTROMSIZE, LIST_LISTCPU, LIST_SOURCEFILE };
+		LIST_LISTROMSIZE, LIST_LISTCPU, LIST_SOURCEFILE, LIST_LISTNAMES };
 #else
 enum { LIST_LIST = 1, LIST_LISTINFO, LIST_LISTFULL, LIST_LISTSAMDIR, LIST_LISTROMS, LIST_LISTSAMPLES,
 		LIST_LMR, LIST_LISTDETAILS, LIST_GAMELISTHEADER, LIST_GAMELISTFOOTER, LIST_GAMELIST,
 		LIST_LISTGAMES, LIST_LISTCLONES,
 		LIST_WRONGORIENTATION, LIST_WRONGFPS, LIST_LISTCRC, LIST_LISTDUPCRC, LIST_WRONGMERGE,
-		LIST_LISTROMSIZE, LIST_LISTCPU, LIST_SOURCEFILE, LIST_MESSINFO };
+		LIST_LISTROMSIZE, LIST_LISTCPU, LIST_SOURCEFILE, LIST_LISTNAMES, LIST_MESSINFO };
 #endif
 
 
@@ -377,6 +377,7 @@ int frontend_help (int argc, char **argv)
 		if (!strcasecmp(argv[i],"-listwrongmerge")) list = LIST_WRONGMERGE;
 		if (!strcasecmp(argv[i],"-listromsize")) list = LIST_LISTROMSIZE;
 		if (!strcasecmp(argv[i],"-listcpu")) list = LIST_LISTCPU;
+		if (!strcasecmp(argv[i],"-listnames")) list = LIST_LISTNAMES; /* one name per line, for scripts */
 		if (!strcasecmp(argv[i],"-wrongorientation")) list = LIST_WRONGORIENTATION;
 		if (!strcasecmp(argv[i],"-wrongfps")) list = LIST_WRONGFPS;
 		if (!strcasecmp(argv[i],"-noclones")) listclones = 0;
@@ -1186,6 +1187,20 @@ int frontend_help (int argc, char **argv)
 			return 0;
 			break;
 
+		case LIST_LISTNAMES: /* bare driver names, used by the benchmark scripts */
+			i = 0;
+			while (drivers[i])
+			{
+				if ((listclones || drivers[i]->clone_of == 0
+						|| (drivers[i]->clone_of->flags & NOT_A_DRIVER)
+						) && !(drivers[i]->flags & NOT_A_DRIVER)
+						&& !strwildcmp(gamename, drivers[i]->name))
+					printf("%s\n",drivers[i]->name);
+				i++;
+			}
+			return 0;
+			break;
+
 		case LIST_LISTCPU: /* I used this for statistical analysis */
 			{
 				int year;
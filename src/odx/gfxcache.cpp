@@ -0,0 +1,189 @@
+/*
+ * Decoded gfx cache.
+ *
+ * decodegfx() walks every pixel of every plane bit by bit, which costs
+ * seconds on the big CPS1/Neo Geo/System16 sets. Its output only depends
+ * on the ROMs, the layout and the orientation, so vh_open() hashes those
+ * into a key and we keep the result in $HOME/.mame4all/gfxcache. Later
+ * launches mmap the file instead of decoding; a key mismatch just means the
+ * element is decoded again and the file rewritten.
+ *
+ * The mapping is MAP_PRIVATE and writable, so drivers that decodechar()
+ * into their elements at run time get copy-on-write pages and never touch
+ * the file. pen_usage is copied to the heap instead: drivers like neogeo
+ * free() and replace it in vh_start.
+ */
+
+#include "driver.h"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+/* from fileio.c */
+extern char *gfxcachedir;
+extern char mdir[512];
+
+int gfxcache_enable = 1;
+
+#define GFXCACHE_MAGIC		0x43584647	/* "GFXC" */
+#define GFXCACHE_VERSION	1
+#define GFXCACHE_ALIGN(n)	(((n) + 31) & ~31)
+
+struct gfxcache_header
+{
+	UINT32 magic;
+	UINT32 version;
+	UINT32 key;
+	UINT32 size;			/* whole file, for munmap() */
+	INT32 width, height;
+	UINT32 total_elements;
+	INT32 color_granularity;
+	INT32 line_modulo, char_modulo;
+	UINT32 pen_usage_offs;		/* 0 if the element has no pen_usage */
+	UINT32 gfxdata_offs;
+};
+
+static void gfxcache_path(char *name,const char *gamename,int num)
+{
+	sprintf(name,"%s%s/%s.%d.gfx",mdir,gfxcachedir,gamename,num);
+}
+
+/* write length bytes of data, then zeros up to padded */
+static int gfxcache_write(FILE *f,const void *data,UINT32 length,UINT32 padded)
+{
+	static const UINT8 zero[32] = { 0 };
+
+	if (length && fwrite(data,length,1,f) != 1)
+		return 0;
+	if (padded > length && fwrite(zero,padded - length,1,f) != 1)
+		return 0;
+	return 1;
+}
+
+struct GfxElement *osd_gfxcache_load(const char *gamename,int num,unsigned int key)
+{
+	char name[1024];
+	struct gfxcache_header *h;
+	struct GfxElement *gfx;
+	struct stat st;
+	void *base;
+	int fd;
+
+	if (!gfxcache_enable || !gfxcachedir)
+		return 0;
+
+	gfxcache_path(name,gamename,num);
+	if ((fd = open(name,O_RDONLY)) < 0)
+		return 0;
+	if (fstat(fd,&st) != 0 || st.st_size < (off_t)sizeof(struct gfxcache_header))
+	{
+		close(fd);
+		return 0;
+	}
+	base = mmap(0,st.st_size,PROT_READ|PROT_WRITE,MAP_PRIVATE,fd,0);
+	close(fd);
+	if (base == MAP_FAILED)
+		return 0;
+
+	h = (struct gfxcache_header *)base;
+	if (h->magic != GFXCACHE_MAGIC || h->version != GFXCACHE_VERSION || h->key != key ||
+			h->size != (UINT32)st.st_size ||
+			h->gfxdata_offs + (UINT64)h->total_elements * h->char_modulo > h->size ||
+			(h->pen_usage_offs && h->pen_usage_offs + (UINT64)h->total_elements * sizeof(int) > h->gfxdata_offs))
+	{
+		logerror("gfxcache: %s is stale\n",name);
+		munmap(base,st.st_size);
+		return 0;
+	}
+
+	if ((gfx = (struct GfxElement *) malloc(sizeof(struct GfxElement))) == 0)
+	{
+		munmap(base,st.st_size);
+		return 0;
+	}
+	memset(gfx,0,sizeof(struct GfxElement));
+
+	gfx->width = h->width;
+	gfx->height = h->height;
+	gfx->total_elements = h->total_elements;
+	gfx->color_granularity = h->color_granularity;
+	gfx->line_modulo = h->line_modulo;
+	gfx->char_modulo = h->char_modulo;
+	if (h->pen_usage_offs)
+	{
+		if ((gfx->pen_usage = (unsigned int *) malloc(h->total_elements * sizeof(int))) == 0)
+		{
+			free(gfx);
+			munmap(base,st.st_size);
+			return 0;
+		}
+		memcpy(gfx->pen_usage,(UINT8 *)base + h->pen_usage_offs,h->total_elements * sizeof(int));
+	}
+	gfx->gfxdata = (UINT8 *)base + h->gfxdata_offs;
+	gfx->cache = base;
+
+	logerror("gfxcache: mapped %s\n",name);
+	return gfx;
+}
+
+void osd_gfxcache_save(const char *gamename,int num,unsigned int key,const struct GfxElement *gfx)
+{
+	char name[1024], tmpname[1024];
+	struct gfxcache_header h;
+	UINT32 pos;
+	FILE *f;
+
+	if (!gfxcache_enable || !gfxcachedir)
+		return;
+
+	memset(&h,0,sizeof(h));
+	h.magic = GFXCACHE_MAGIC;
+	h.version = GFXCACHE_VERSION;
+	h.key = key;
+	h.width = gfx->width;
+	h.height = gfx->height;
+	h.total_elements = gfx->total_elements;
+	h.color_granularity = gfx->color_granularity;
+	h.line_modulo = gfx->line_modulo;
+	h.char_modulo = gfx->char_modulo;
+	pos = GFXCACHE_ALIGN(sizeof(h));
+	if (gfx->pen_usage)
+	{
+		h.pen_usage_offs = pos;
+		pos = GFXCACHE_ALIGN(pos + gfx->total_elements * sizeof(int));
+	}
+	h.gfxdata_offs = pos;
+	h.size = pos + gfx->total_elements * gfx->char_modulo;
+
+	sprintf(name,"%s%s",mdir,gfxcachedir);
+	mkdir(name,S_IRWXU | S_IRWXG | S_IRWXO);
+
+	/* write under a temporary name so a crash never leaves a truncated entry */
+	gfxcache_path(name,gamename,num);
+	sprintf(tmpname,"%s.tmp",name);
+	if ((f = fopen(tmpname,"wb")) == 0)
+		return;
+
+	if (!gfxcache_write(f,&h,sizeof(h),GFXCACHE_ALIGN(sizeof(h))) ||
+			(gfx->pen_usage && !gfxcache_write(f,gfx->pen_usage,gfx->total_elements * sizeof(int),
+				h.gfxdata_offs - h.pen_usage_offs)) ||
+			!gfxcache_write(f,gfx->gfxdata,h.size - h.gfxdata_offs,h.size - h.gfxdata_offs))
+	{
+		fclose(f);
+		unlink(tmpname);
+		return;
+	}
+	if (fclose(f) != 0 || rename(tmpname,name) != 0)
+		unlink(tmpname);
+}
+
+void osd_gfxcache_free(struct GfxElement *gfx)
+{
+	free(gfx->pen_usage);
+	munmap(gfx->cache,((struct gfxcache_header *)gfx->cache)->size);
+	gfx->cache = 0;
+	gfx->pen_usage = 0;
+	gfx->gfxdata = 0;
+}
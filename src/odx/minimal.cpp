@@ -40,18 +40,26 @@ unsigned int			odx_palette_rgb[256];
 
 int						odx_clock=366;
 SDL_AudioSpec 			odx_audio_spec;
-SDL_mutex 				*sndlock;
-unsigned int			odx_audio_buffer_len=0;
-unsigned int			odx_buf_read_pos=0;
-unsigned int			odx_buf_write_pos=0;
-unsigned int			odx_sndlen=0;
+unsigned int			odx_audio_buffer_len=0;	/* ring size, power of two */
+unsigned int			odx_audio_buffer_limit=0;	/* max fill = latency target */
+volatile unsigned int	odx_buf_read_pos=0;		/* owned by the audio callback */
+volatile unsigned int	odx_buf_write_pos=0;	/* owned by odx_sound_play */
+unsigned int			odx_audio_latency=32;	/* target latency in ms */
+unsigned int			odx_audio_target=0;		/* same, in bytes */
+float					odx_audio_ratio=1.0f;	/* current rate control ratio */
+volatile unsigned int	odx_audio_underruns=0;
+unsigned int			odx_audio_overruns=0;
+static SDL_sem			*odx_audio_drained=NULL;	/* posted by the callback */
 unsigned int			odx_vol = 100;
 unsigned int			odx_sound_rate=44100;
 int						odx_sound_stereo=1;
 int						rotate_controls=0;
 unsigned char			odx_keys[OD_KEY_MAX];
 SDL_Joystick			*odx_joyanalog[] = {0,0};
-unsigned int            odx_video_regulator = 1100;
+int						odx_headless=0;
+FILE					*odx_audio_sink=NULL;
+unsigned long			odx_audio_sink_bytes=0;
+static int				odx_audio_null=0;
 
 extern int master_volume;
 bool ui_exit = false;
@@ -134,6 +142,8 @@ unsigned int odx_keyboard_read()
 {
 	unsigned int res = 0;
 
+	if (odx_headless) return 0;
+
 	while(SDL_PollEvent(&event)) {
     switch(event.type) {
       case SDL_WINDOWEVENT:
@@ -305,6 +315,7 @@ unsigned long odx_timer_read(void)
 
 void odx_video_wait_vsync(void) 
 {
+    if (odx_headless) return;
     disp_wait_for_frame();
 }
 
@@ -314,14 +325,21 @@ printf("odx_sound_volume(void)\n");
  	if( vol < 0 ) vol = 0;
  	if( vol > 100 ) vol = 100;
 
+ 	if( odx_audio_null ) {
+ 		if( vol > 0 ) master_volume = vol;
+ 		odx_vol = vol;
+ 		return;
+ 	}
+
  	if( vol > 0 ) {
  		master_volume = vol;
  		if( odx_vol == 0 ) {
 printf("Audio started.\n");
+ 			/* drop stale samples while the callback can't run */
+ 			SDL_LockAudio();
+ 			odx_buf_read_pos = odx_buf_write_pos;
+ 			SDL_UnlockAudio();
  			SDL_PauseAudio(0);
- 			if( odx_audio_spec.userdata )
-	 			memset( odx_audio_spec.userdata, 0 , odx_audio_buffer_len );
- 			odx_sndlen = 0;
  		}
  	}
  	else {
@@ -332,63 +350,208 @@ printf("Audio stopped.\n");
  	odx_vol = vol;
 }
 
-void odx_sound_play(void *buff, int len)
+/* Null audio sink: samples are consumed as fast as the emulation produces */
+/* them and optionally dumped as raw PCM. Used headless and when SDL audio */
+/* cannot be opened. */
+static void odx_sound_sink(void *buff, int len)
+{
+	odx_audio_sink_bytes += len;
+	if( odx_audio_sink && odx_vol )
+		fwrite( buff, 1, len, odx_audio_sink );
+}
+
+/* The SDL audio path is a single producer (emulation thread) / single */
+/* consumer (audio callback) ring buffer. Each side only writes its own */
+/* position; positions grow freely and wrap with unsigned arithmetic.   */
+#define odx_ring_load(p)		__atomic_load_n(&(p), __ATOMIC_ACQUIRE)
+#define odx_ring_store(p,v)		__atomic_store_n(&(p), (v), __ATOMIC_RELEASE)
+
+/* Dynamic rate control: the emulation's sample clock and the sound card */
+/* never agree exactly, so every chunk is stretched or squeezed by at most */
+/* ODX_AUDIO_DRC_MAX to hold the ring fill at the latency target. */
+#define ODX_AUDIO_DRC_MAX		0.005f
+
+static short	*odx_drc_buffer=NULL;
+static unsigned int	odx_drc_chunk;	/* bytes resampled at a time */
+static unsigned int	odx_drc_size;	/* odx_drc_buffer, a chunk stretched to the max */
+static float	odx_drc_fill;
+static float	odx_drc_carry;
+static Uint32	odx_audio_wait;	/* ms, one callback period */
+
+static int odx_sound_resample(const short *src, int len, unsigned int fill)
 {
-	SDL_LockMutex(sndlock);
-	int i = 0;
-	while( odx_sndlen+len > odx_audio_buffer_len ) {
-        if(i == 5 && odx_video_regulator > 900) odx_video_regulator -= 5;
-//printf("AUDIO Overrun %d %d\n", i, odx_video_regulator);        
-		if(i++ > 100) {
-			// Overrun 
-		  odx_sndlen = 0;
-		  SDL_UnlockMutex(sndlock);
-		  return;
+	int channels = odx_audio_spec.channels;
+	int n = len / (2 * channels);
+	int m, i, c;
+
+	/* low pass the fill level, it jitters by a callback buffer */
+	odx_drc_fill += ((float)fill - odx_drc_fill) * 0.0625f;
+
+	float adjust = ODX_AUDIO_DRC_MAX * ((float)odx_audio_target - odx_drc_fill) / odx_audio_target;
+	if( adjust > ODX_AUDIO_DRC_MAX ) adjust = ODX_AUDIO_DRC_MAX;
+	if( adjust < -ODX_AUDIO_DRC_MAX ) adjust = -ODX_AUDIO_DRC_MAX;
+	odx_audio_ratio = 1.0f + adjust;
+
+	odx_drc_carry += n * odx_audio_ratio;
+	m = (int)odx_drc_carry;
+	odx_drc_carry -= m;
+
+	if( m == n || n < 2 || m < 2 || m * 2 * channels > odx_drc_size ) {
+		memcpy( odx_drc_buffer, src, len );
+		return len;
+	}
+
+	/* linear interpolation, first and last sample of the chunk kept */
+	unsigned int step = ((n - 1) << 16) / (m - 1);
+	unsigned int p = 0;
+	short *dst = odx_drc_buffer;
+	for( i = 0; i < m; i++, p += step ) {
+		int s0 = p >> 16;
+		int s1 = s0 + 1 < n ? s0 + 1 : s0;
+		int f = (p & 0xffff) >> 1;	/* 15 bits so (b - a) * f fits */
+		for( c = 0; c < channels; c++ ) {
+			int a = src[s0 * channels + c];
+			int b = src[s1 * channels + c];
+			*dst++ = a + (((b - a) * f) >> 15);
 		}
-		SDL_UnlockMutex(sndlock);
-		usleep(2000);
-		SDL_LockMutex(sndlock);
 	}
+	return m * 2 * channels;
+}
 
-	if( odx_audio_spec.userdata ) {
-		memcpy( (char*)odx_audio_spec.userdata + odx_sndlen, buff, len );
-		odx_sndlen += len;
+static void odx_sound_play_chunk(const short *buff, int len)
+{
+	unsigned char *ring = (unsigned char *)odx_audio_spec.userdata;
+	unsigned int mask = odx_audio_buffer_len - 1;
+	unsigned int w = odx_buf_write_pos;
+	unsigned int r = odx_ring_load(odx_buf_read_pos);
+
+	len = odx_sound_resample( buff, len, w - r );
+	buff = odx_drc_buffer;
+
+	/* Ring full despite rate control: sleep until the callback drains it, */
+	/* for at most one callback period so a frame never stalls for long, */
+	/* then drop the chunk. */
+	if( (w - r) + len > odx_audio_buffer_limit ) {
+		Uint32 start = SDL_GetTicks();
+		Uint32 waited = 0;
+		while( (w - r) + len > odx_audio_buffer_limit ) {
+			if( waited >= odx_audio_wait || !odx_audio_drained ||
+					SDL_SemWaitTimeout( odx_audio_drained, odx_audio_wait - waited ) == SDL_MUTEX_TIMEDOUT ) {
+				odx_audio_overruns++;
+				return;
+			}
+			waited = SDL_GetTicks() - start;
+			r = odx_ring_load(odx_buf_read_pos);
+		}
 	}
 
-	SDL_UnlockMutex(sndlock);
+	unsigned int pos = w & mask;
+	unsigned int first = odx_audio_buffer_len - pos;
+	if( first > (unsigned int)len ) first = len;
+	memcpy( ring + pos, buff, first );
+	memcpy( ring, (char*)buff + first, len - first );
+
+	odx_ring_store(odx_buf_write_pos, w + len);
 }
 
-static void odx_sound_callback(void *data, Uint8 *stream, int len)
+void odx_sound_play(void *buff, int len)
 {
-	SDL_LockMutex(sndlock);
-	
-	if( odx_sndlen < len ) {
-        if(odx_video_regulator < 2000) odx_video_regulator += 20;
-//printf("AUDIO Underrun %d\n", odx_video_regulator);        
-		memcpy( stream, data, odx_sndlen );
-		memset( stream+odx_sndlen, 0, len-odx_sndlen);
-		odx_sndlen = 0;
-		SDL_UnlockMutex(sndlock);
+	if( odx_audio_null ) {
+		odx_sound_sink(buff, len);
 		return;
 	}
-	memcpy( stream, data, len );
-	odx_sndlen -= len;
-	memcpy( data, (Uint8*)data + len, odx_sndlen );
 
-	SDL_UnlockMutex(sndlock);
+	if( !odx_audio_spec.userdata || !odx_drc_buffer ) return;
+
+	/* a frame of low fps/high rate audio can be bigger than the latency */
+	/* target; feed it in pieces that always fit the ring */
+	while( len > 0 ) {
+		int n = len < (int)odx_drc_chunk ? len : odx_drc_chunk;
+		odx_sound_play_chunk( (const short *)buff, n );
+		buff = (char *)buff + n;
+		len -= n;
+	}
+}
+
+static void odx_sound_callback(void *data, Uint8 *stream, int len)
+{
+	unsigned char *ring = (unsigned char *)data;
+	unsigned int mask = odx_audio_buffer_len - 1;
+	unsigned int r = odx_buf_read_pos;
+	unsigned int w = odx_ring_load(odx_buf_write_pos);
+	unsigned int n = w - r;
+
+	if( n < (unsigned int)len ) {
+		odx_audio_underruns++;
+		memset( stream + n, 0, len - n );
+	}
+	else n = len;
+
+	unsigned int pos = r & mask;
+	unsigned int first = odx_audio_buffer_len - pos;
+	if( first > n ) first = n;
+	memcpy( stream, ring + pos, first );
+	memcpy( stream + first, ring, n - first );
+
+	odx_ring_store(odx_buf_read_pos, r + n);
+
+	/* wake a waiting producer; the count never goes above one, so posts */
+	/* nobody waited for don't pile up */
+	if( SDL_SemValue(odx_audio_drained) == 0 )
+		SDL_SemPost(odx_audio_drained);
 }
 
 void odx_sound_thread_start(void)
 {
-	odx_sndlen=0;
+	odx_buf_read_pos=0;
+	odx_buf_write_pos=0;
+	odx_audio_underruns=0;
+	odx_audio_overruns=0;
+	odx_audio_sink_bytes=0;
+
+	if (odx_headless) {
+		printf("Audio to null sink.\n");
+		odx_audio_null=1;
+		return;
+	}
+
 printf("Starting audio...\n");
     odx_audio_spec.freq = odx_sound_rate;
     odx_audio_spec.channels = odx_sound_stereo ? 2: 1;
 
-	odx_audio_buffer_len = 16384; // odx_audio_spec.samples * odx_audio_spec.channels * 2 * 64;
+	/* callback buffer about a third of the latency target, so the fill */
+	/* level the rate control sees moves in small steps */
+	unsigned int bytes_per_ms = odx_audio_spec.freq * odx_audio_spec.channels * 2 / 1000;
+	odx_audio_spec.samples = 1024;
+	while( odx_audio_spec.samples > 256 &&
+			odx_audio_spec.samples * 3 > odx_audio_latency * odx_audio_spec.freq / 1000 )
+		odx_audio_spec.samples >>= 1;
+
+	/* rate control aims at the target, the ring holds twice that */
+	unsigned int min_target = odx_audio_spec.samples * odx_audio_spec.channels * 2 * 2;
+	odx_audio_target = (odx_audio_latency * bytes_per_ms) & ~3;
+	if( odx_audio_target < min_target ) odx_audio_target = min_target;
+	odx_audio_buffer_limit = odx_audio_target * 2;
+	odx_audio_buffer_len = 4096;
+	while( odx_audio_buffer_len < odx_audio_buffer_limit ) odx_audio_buffer_len <<= 1;
+	printf("Audio latency target %d ms, %d bytes\n", odx_audio_target / bytes_per_ms, odx_audio_target);
+
+	odx_audio_wait = odx_audio_spec.samples * 1000 / odx_audio_spec.freq + 1;
+
+	/* half the target per chunk, whole sample frames, and room for it to */
+	/* be stretched by ODX_AUDIO_DRC_MAX plus the carried fraction */
+	unsigned int frame = odx_audio_spec.channels * 2;
+	odx_drc_chunk = odx_audio_target / 2 / frame * frame;
+	odx_drc_size = (odx_drc_chunk / frame + odx_drc_chunk / frame / 100 + 2) * frame;
+	odx_drc_fill = odx_audio_target;
+	odx_drc_carry = 0;
+	odx_audio_ratio = 1.0f;
+	odx_drc_buffer = (short *)malloc( odx_drc_size );
+
 	void *audiobuf = malloc( odx_audio_buffer_len );
 	memset( audiobuf, 0 , odx_audio_buffer_len );
 	odx_audio_spec.userdata=audiobuf;
+	odx_audio_drained = SDL_CreateSemaphore(0);
 
   SDL_AudioSpec actual_audio_spec;
   
@@ -399,8 +562,15 @@ printf("Starting audio...\n");
     odx_audio_spec.samples);
     
 	if ( SDL_OpenAudio(&odx_audio_spec, &actual_audio_spec) < 0 ) {
-		fprintf(stderr, "Unable to open audio: %s\n", SDL_GetError());
-		exit(1);
+		fprintf(stderr, "Unable to open audio: %s, using null sink\n", SDL_GetError());
+		free( odx_audio_spec.userdata );
+		odx_audio_spec.userdata = NULL;
+		free( odx_drc_buffer );
+		odx_drc_buffer = NULL;
+		SDL_DestroySemaphore( odx_audio_drained );
+		odx_audio_drained = NULL;
+		odx_audio_null=1;
+		return;
 	}
   
   printf("Audio format %d, freq %d, channels %d, samples %d\n",
@@ -409,15 +579,6 @@ printf("Starting audio...\n");
     actual_audio_spec.channels,
     actual_audio_spec.samples);
   
-  
-  
-	sndlock = SDL_CreateMutex();
-	if (sndlock == NULL) {
-		fprintf(stderr, "Unable to create lock: %s\n", SDL_GetError());
-		SDL_CloseAudio();
-        exit(1);
-	}
-	
 	SDL_PauseAudio(0);
 
   printf("Audio started.\n");
@@ -425,16 +586,25 @@ printf("Starting audio...\n");
 
 void odx_sound_thread_stop(void)
 {
+	if( odx_audio_null ) {
+		odx_audio_null=0;
+		if( odx_audio_sink ) fflush( odx_audio_sink );
+		return;
+	}
+
 	if( odx_audio_spec.userdata ) {
 printf("odx_sound_thread_stop(void)\n");
 		SDL_PauseAudio(1);
-printf("Audio stopped.\n");
-		SDL_DestroyMutex(sndlock);
+printf("Audio stopped, %d underruns, %d overruns, rate %.4f.\n", odx_audio_underruns, odx_audio_overruns, odx_audio_ratio);
 		SDL_CloseAudio();
 		SDL_QuitSubSystem(SDL_INIT_AUDIO);
 
 		free( odx_audio_spec.userdata );
 		odx_audio_spec.userdata = NULL;
+		free( odx_drc_buffer );
+		odx_drc_buffer = NULL;
+		SDL_DestroySemaphore( odx_audio_drained );
+		odx_audio_drained = NULL;
 	}
 }
 
@@ -445,6 +615,28 @@ void odx_init(int ticks_per_second, int bpp, int rate, int bits, int stereo, int
 	for(int i = 0 ; i < OD_KEY_MAX ; i++ ) {
 		odx_keys[i] = 0;
 	}
+
+    odx_audio_spec.freq = rate;
+	if( bits == 16 )
+    	odx_audio_spec.format = AUDIO_S16SYS;
+    else
+    	odx_audio_spec.format = AUDIO_S8;
+    odx_audio_spec.channels = stereo ? 2: 1;
+    odx_audio_spec.samples = 1024;
+    odx_audio_spec.callback = odx_sound_callback;
+    odx_audio_spec.userdata = NULL;
+
+	if (odx_headless) {
+		printf("Headless mode, no display or audio device\n");
+		colRenderer = COL_CreateHeadlessRenderer();
+		if (!colRenderer) exit(1);
+		odx_set_video_mode(bpp,ODX_SCREEN_WIDTH,ODX_SCREEN_HEIGHT);
+		odx_video_color8(0,0,0,0);
+		odx_video_color8(255,255,255,255);
+		odx_clear_video();
+		return;
+	}
+
   // Initialize SDL.
   if (SDL_Init(SDL_INIT_VIDEO|SDL_INIT_JOYSTICK|SDL_INIT_AUDIO) < 0) {
           exit(1);
@@ -497,16 +689,6 @@ void odx_init(int ticks_per_second, int bpp, int rate, int bits, int stereo, int
 	SDL_EventState(SDL_USEREVENT,SDL_IGNORE);
 	SDL_ShowCursor(SDL_DISABLE);
 
-    odx_audio_spec.freq = rate;
-	if( bits == 16 )
-    	odx_audio_spec.format = AUDIO_S16SYS;
-    else
-    	odx_audio_spec.format = AUDIO_S8;
-    odx_audio_spec.channels = stereo ? 2: 1;
-    odx_audio_spec.samples = 1024;
-    odx_audio_spec.callback = odx_sound_callback;
-    odx_audio_spec.userdata = NULL;
-
 	odx_set_video_mode(bpp,ODX_SCREEN_WIDTH,ODX_SCREEN_HEIGHT);
 
 	odx_video_color8(0,0,0,0);
@@ -522,7 +704,13 @@ printf("odx_deinit(void).\n");
 
 	odx_sound_thread_stop();
 	COL_DestroyRenderer(colRenderer);
-	SDL_QuitSubSystem(SDL_INIT_VIDEO|SDL_INIT_AUDIO|SDL_INIT_JOYSTICK);
+	colRenderer = NULL;
+	if (odx_audio_sink) {
+		fclose(odx_audio_sink);
+		odx_audio_sink = NULL;
+	}
+	if (!odx_headless)
+		SDL_QuitSubSystem(SDL_INIT_VIDEO|SDL_INIT_AUDIO|SDL_INIT_JOYSTICK);
 }
 
 void odx_set_clock(int mhz)
@@ -534,6 +722,12 @@ void odx_set_video_mode(int bpp,int width,int height)
 {
   printf("void odx_set_video_mode(int bpp %d,int width %d,int height %d)\n", bpp, width, height);
   
+  if (odx_headless) {
+    COL_CreateTexture(colRenderer, width, height, 0, 0, width, height);
+    odx_clear_video();
+    return;
+  }
+
   int x,y,w,h;
   SDL_GetWindowSize(sdlWindow, &w, &h);
   SDL_GetWindowPosition(sdlWindow, &x, &y);  
@@ -17,6 +17,7 @@
 #define __MINIMAL_H__
 
 #include <sys/time.h>
+#include <stdio.h>
 #include <unistd.h>
 #include <stdarg.h>
 
@@ -66,6 +67,14 @@ extern int						odx_sound_stereo;
 
 extern int						rotate_controls;
 
+extern int						odx_headless;
+extern FILE					*odx_audio_sink;
+extern unsigned long			odx_audio_sink_bytes;
+extern unsigned int			odx_audio_latency;
+extern float					odx_audio_ratio;
+extern volatile unsigned int	odx_audio_underruns;
+extern unsigned int			odx_audio_overruns;
+
 extern SDL_Joystick				*odx_joyanalog[];
 extern signed int axis_x[],axis_y[];
 
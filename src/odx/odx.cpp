@@ -23,6 +23,8 @@ void msdos_shutdown_input(void);
 int  frontend_help (int argc, char **argv);
 void parse_cmdline (int argc, char **argv, int game);
 void init_inpdir(void);
+void osd_bench_report(const char *status);
+void osd_bench_header(void);
 
 static FILE *errorlog;
 
@@ -40,8 +42,27 @@ int osd_init(void)
 /* put here cleanup routines to be executed when the program is terminated. */
 void osd_exit(void)
 {
+	extern void workers_stop(void);
+	extern void unzip_cache_clear(void);
+
 	msdos_shutdown_sound();
 	msdos_shutdown_input();
+	workers_stop();
+	/* the next game or audit rereads its zips */
+	unzip_cache_clear();
+}
+
+int osd_simd = 1;	/* -nosimd */
+
+/* the blit, tilemap and FM cores each build their own NEON or SSE2 */
+/* kernels from the same compiler flags, so they share this one switch */
+int osd_cpu_has_simd(void)
+{
+#if defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(__SSE2__)
+	return osd_simd;
+#else
+	return 0;
+#endif
 }
 
 /* fuzzy string compare, compare short string against long string        */
@@ -82,6 +103,26 @@ int fuzzycmp (const char *s, const char *l)
 	return gaps;
 }
 
+/* back to the frontend with the options it was started with */
+static void frontend_return(bool fullscreen, bool audit)
+{
+	char *args[5];
+	int n=0;
+
+	args[n]=(char *)"mame.dge"; n++;
+	args[n]=(char *)"cache"; n++;
+	if (fullscreen)
+	{
+		args[n]=(char *)"-fullscreen"; n++;
+	}
+	if (audit)
+	{
+		args[n]=(char *)"-audit"; n++;
+	}
+	args[n]=NULL;
+	execv(args[0], args);
+}
+
 int main (int argc, char **argv)
 {
 	int res, i, j = 0, game_index;
@@ -89,10 +130,26 @@ int main (int argc, char **argv)
 	int use_fame=0;
     bool fullscreen=false;
     bool frontend=false;
+    bool audit=false;
    	extern int video_scale;
 	extern int video_border;
 	extern int video_aspect;
 	extern int throttle;
+	extern int bench_seconds;
+	extern int render_thread;
+	extern int osd_simd;
+	extern int worker_threads;
+	extern int streams_parallel;
+	extern int tilemap_parallel;
+	extern int fm_block,fm_check;
+	extern int FMSelfTest(int frames);
+	extern int neogeo_prefetch;
+	extern FILE *tilemap_capture;
+	extern int cpu_defer_audio;
+	extern int idle_skip,idle_reset;
+	extern int cpu_stats,cpu_autoslice;
+	extern FILE *bench_csv,*bench_json;
+	extern int frameskip,autoframeskip;
 
 	memset(&options,0,sizeof(options));
 
@@ -119,14 +176,75 @@ int main (int argc, char **argv)
 			fullscreen=true;
 		if (strcasecmp(argv[i],"-frontend") == 0)
 			frontend=true;
+		if (strcasecmp(argv[i],"-audit") == 0)
+			audit=true;
+		if (strcasecmp(argv[i],"-headless") == 0)
+			odx_headless=1;
+		if (strcasecmp(argv[i],"-renderthread") == 0)
+			render_thread=1;
+		if (strcasecmp(argv[i],"-parallelsound") == 0)
+			streams_parallel=1;
+		if (strcasecmp(argv[i],"-paralleltilemap") == 0)
+			tilemap_parallel=1;
+		if (strcasecmp(argv[i],"-neoprefetch") == 0)
+			neogeo_prefetch=1;
+		if (strcasecmp(argv[i],"-deferaudio") == 0)
+			cpu_defer_audio=1;
+		if (strcasecmp(argv[i],"-idleskip") == 0)
+			idle_skip=1;
+		if (strcasecmp(argv[i],"-idlereset") == 0)
+			idle_reset=1;
+		if (strcasecmp(argv[i],"-cpustats") == 0)
+			cpu_stats=1;
+		if (strcasecmp(argv[i],"-autoslice") == 0)
+			cpu_autoslice=1;
+		if (strcasecmp(argv[i],"-nosimd") == 0)
+			osd_simd=0;
+		if (strcasecmp(argv[i],"-nofmblock") == 0)
+			fm_block=0;
+		if (strcasecmp(argv[i],"-fmcheck") == 0)
+			fm_check=1;
+		if ((strcasecmp(argv[i],"-threads") == 0) && (i<argc-1))
+			worker_threads=atoi(argv[i+1]);
+		if (strcasecmp(argv[i],"-timerbench") == 0)
+		{
+			timer_queue_benchmark();
+			exit(0);
+		}
+		if (strcasecmp(argv[i],"-fmselftest") == 0)
+			exit(FMSelfTest(3000) ? 1 : 0);
+		if ((strcasecmp(argv[i],"-tilemapbench") == 0) && (i<argc-1))
+		{
+			tilemap_benchmark(argv[i+1]);
+			exit(0);
+		}
+		if ((strcasecmp(argv[i],"-tilemapcapture") == 0) && (i<argc-1))
+			tilemap_capture=fopen(argv[i+1],"wb");
+		if ((strcasecmp(argv[i],"-audiosink") == 0) && (i<argc-1))
+		{
+			odx_audio_sink=fopen(argv[i+1],"wb");
+			if (!odx_audio_sink)
+				printf("Unable to open audio sink %s\n",argv[i+1]);
+		}
 		if (strcasecmp(argv[i],"-border") == 0)
 			video_border=1;
 		if (strcasecmp(argv[i],"-aspect") == 0)
 			video_aspect=1;
 		if (strcasecmp(argv[i],"-nothrottle") == 0)
 			throttle=0;
+		if ((strcasecmp(argv[i],"-bench") == 0) && (i<argc-1))
+		{
+			bench_seconds=atoi(argv[i+1]);
+			throttle=0;
+		}
+		if ((strcasecmp(argv[i],"-benchcsv") == 0) && (i<argc-1))
+			bench_csv=fopen(argv[i+1],"a");
+		if ((strcasecmp(argv[i],"-benchjson") == 0) && (i<argc-1))
+			bench_json=fopen(argv[i+1],"a");
 		if ((strcasecmp(argv[i],"-clock") == 0) && (i<argc-1))
 			odx_clock=atoi(argv[i+1]);
+		if ((strcasecmp(argv[i],"-audiolatency") == 0) && (i<argc-1))
+			odx_audio_latency=atoi(argv[i+1]);
         	if (strcasecmp(argv[i],"-playback") == 0)
 		{
 			i++;
@@ -145,7 +263,7 @@ int main (int argc, char **argv)
 	if (res != 1234)
 	{
 		odx_deinit();
-    if(frontend) execl("mame.dge", "mame.dge", "cache", fullscreen ? "-fullscreen" : NULL, NULL);
+    if(frontend && !odx_headless) frontend_return(fullscreen, audit);
 		exit (res);
 	}
 
@@ -251,6 +369,14 @@ int main (int argc, char **argv)
 	/* parse generic (os-independent) options */
 	parse_cmdline (argc, argv, game_index);
 
+	/* benchmark runs unthrottled and draws every frame */
+	if (bench_seconds > 0)
+	{
+		frameskip=0;
+		autoframeskip=0;
+		throttle=0;
+	}
+
 {	/* Mish:  I need sample rate initialised _before_ rom loading for optional rom regions */
 	extern int soundcard;
 
@@ -355,15 +481,24 @@ int main (int argc, char **argv)
 
     /* go for it */
     printf ("%s (%s)...\n",drivers[game_index]->description,drivers[game_index]->name);
+	/* header before the run, so distrib/bench.sh can add the row of a */
+	/* game that crashes or hangs */
+	if (bench_csv)
+		osd_bench_header();
     res = run_game (game_index);
 
+	if (bench_seconds > 0)
+		osd_bench_report(res ? "failed" : "ok");
+	if (bench_csv) fclose (bench_csv);
+	if (bench_json) fclose (bench_json);
+
 	/* close open files */
 	if (errorlog) fclose (errorlog);
 	if (options.playback) osd_fclose (options.playback);
 	if (options.record)   osd_fclose (options.record);
 	if (options.language_file) osd_fclose (options.language_file);
 
-	if (res!=0)
+	if (res!=0 && !odx_headless)
 	{
 		/* wait a key press */
 		odx_video_flip_single();
@@ -372,7 +507,7 @@ int main (int argc, char **argv)
 
    	odx_deinit();
 
-    if(frontend) execl("mame.dge", "mame.dge", "cache", fullscreen ? "-fullscreen" : NULL, NULL);
+    if(frontend && !odx_headless) frontend_return(fullscreen, audit);
 
 	exit (res);
 }
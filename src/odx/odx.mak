@@ -7,7 +7,7 @@ OSOBJS = $(OBJ)/odx/fastmem.o $(OBJ)/odx/minimal.o \
 	$(OBJ)/odx/odx.o $(OBJ)/odx/video.o $(OBJ)/odx/blit.o \
 	$(OBJ)/odx/sound.o $(OBJ)/odx/input.o $(OBJ)/odx/fileio.o \
 	$(OBJ)/odx/config.o $(OBJ)/odx/fronthlp.o $(OBJ)/odx/ve.o $(OBJ)/odx/disp.o  \
-	$(OBJ)/odx/col.o
+	$(OBJ)/odx/col.o $(OBJ)/odx/gfxcache.o $(OBJ)/odx/workers.o
 	
 	
 FEOBJS = $(OBJ)/odx/fastmem.o $(OBJ)/odx/minimal.o $(OBJ)/odx/odx_frontend.o \
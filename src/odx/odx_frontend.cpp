@@ -5,6 +5,10 @@
 #include <sys/stat.h>
 #include <fcntl.h>
 #include <dirent.h>
+#include <errno.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
 
 #include "minimal.h"
 
@@ -179,86 +183,388 @@ printf("odx_intro_screen(void) - failed to read menu image\n");
     }
 }
 
-static void game_list_init_nocache(void)
+/* ROM availability index.
+ *
+ * Every directory entry is looked up in a hash of the driver names, so a
+ * scan is one pass over the rom directory however many drivers there are.
+ * The result is kept in frontend/mame.idx, stamped with the directory's
+ * device, inode and mtime: while those match, startup doesn't read the
+ * directory at all. Sets that carry an audit result are still checked one
+ * by one, since a zip copied over in place or a file changed inside a set
+ * directory leaves the directory alone. Only sets whose size or mtime
+ * changed lose their audit status; a directory set counts the size and
+ * newest mtime of its files.
+ *
+ * With -audit a background thread runs "<emu> -verifyroms" on each set that
+ * hasn't been checked yet, and the index remembers which ones are bad. */
+
+#define ROMIDX_MAGIC	0x58444952	/* "RIDX" */
+#define ROMIDX_VERSION	1
+
+#define ROM_MISSING		0
+#define ROM_PRESENT		1	/* found, not audited yet */
+#define ROM_VERIFIED	2
+#define ROM_BAD			3
+
+struct romidx_header
 {
-	char text[512];
+	unsigned int magic;
+	unsigned int version;
+	unsigned int dir_dev, dir_ino, dir_mtime;
+	unsigned int count;
+	char romdir[512];
+};
+
+struct romidx_entry
+{
+	char name[16];
+	unsigned int mtime, size;
+	unsigned int status;
+};
+
+#define DRIVER_HASH_SIZE 8192	/* power of two, more than twice NUMGAMES */
+static short driver_hash[DRIVER_HASH_SIZE];	/* driver index + 1, 0 = free */
+static int driver_hash_ready=0;
+
+static volatile unsigned char rom_status[NUMGAMES];
+static unsigned int rom_mtime[NUMGAMES];
+static unsigned int rom_size[NUMGAMES];
+static char rom_scandir[512];
+static struct stat rom_scandir_st;
+static volatile int rom_index_dirty=0;
+
+static int rom_audit=0;	/* -audit */
+static SDL_Thread *audit_thread=0;
+static volatile int audit_quit=0;
+static volatile pid_t audit_pid=0;
+
+static unsigned int driver_name_hash(const char *name, int len)
+{
+	unsigned int h=2166136261u;
+	while (len--)
+		h=(h^(unsigned char)*name++)*16777619u;
+	return h;
+}
+
+static void driver_hash_init(void)
+{
+	unsigned int h;
+	int i;
+	if (driver_hash_ready)
+		return;
+	/* in list order, so a duplicated name still finds its first driver */
+	for (i=0;i<NUMGAMES;i++)
+	{
+		h=driver_name_hash(drivers[i].name,strlen(drivers[i].name)) & (DRIVER_HASH_SIZE-1);
+		while (driver_hash[h])
+			h=(h+1) & (DRIVER_HASH_SIZE-1);
+		driver_hash[h]=i+1;
+	}
+	driver_hash_ready=1;
+}
+
+/* driver whose name is the first len characters of name, or -1 */
+static int driver_find(const char *name, int len)
+{
+	unsigned int h;
 	int i;
+	if (len<=0 || len>=(int)sizeof(drivers[0].name))
+		return -1;
+	h=driver_name_hash(name,len) & (DRIVER_HASH_SIZE-1);
+	while (driver_hash[h])
+	{
+		i=driver_hash[h]-1;
+		if (strncmp(drivers[i].name,name,len)==0 && drivers[i].name[len]==0)
+			return i;
+		h=(h+1) & (DRIVER_HASH_SIZE-1);
+	}
+	return -1;
+}
+
+/* size and newest mtime of a set, path being its zip or its directory */
+static int rom_set_stat(char *path, int zip, unsigned int *mtime, unsigned int *size)
+{
+	struct stat st;
+	struct dirent *actual;
+	DIR *d;
+	int len;
+	if (stat(path,&st)!=0 || (zip ? !S_ISREG(st.st_mode) : !S_ISDIR(st.st_mode)))
+		return -1;
+	*mtime=st.st_mtime;
+	*size=zip ? st.st_size : 0;
+	if (zip || (d=opendir(path))==0)
+		return 0;
+	len=strlen(path);
+	while ((actual=readdir(d))!=0)
+	{
+		if (actual->d_name[0]=='.')
+			continue;
+		snprintf(path+len,1024-len,"/%s",actual->d_name);
+		if (stat(path,&st)==0 && S_ISREG(st.st_mode))
+		{
+			if ((unsigned int)st.st_mtime>*mtime)
+				*mtime=st.st_mtime;
+			*size+=st.st_size;
+		}
+	}
+	path[len]=0;
+	closedir(d);
+	return 0;
+}
+
+/* returns 1 if the index is still valid for the directory as it is now */
+static int game_list_load_index(void)
+{
+	char text[512];
+	struct romidx_header h;
+	struct romidx_entry e;
+	char path[1024];
+	unsigned int mtime, size;
 	FILE *f;
-	if (strlen(romdir))
-		strcpy(text,romdir);
-	else
-		sprintf(text,"%s/roms",mamedir);
-	DIR *d=opendir(text);
-	char game[32];
-	if (d)
+	int i, fresh;
+	sprintf(text,"%s/frontend/mame.idx",mamedir);
+	f=fopen(text,"rb");
+	if (!f)
+		return 0;
+	if (fread(&h,sizeof(h),1,f)!=1 || h.magic!=ROMIDX_MAGIC || h.version!=ROMIDX_VERSION ||
+			strncmp(h.romdir,rom_scandir,sizeof(h.romdir))!=0)
+	{
+		fclose(f);
+		return 0;
+	}
+	fresh=(h.dir_dev==(unsigned int)rom_scandir_st.st_dev &&
+		h.dir_ino==(unsigned int)rom_scandir_st.st_ino &&
+		h.dir_mtime==(unsigned int)rom_scandir_st.st_mtime);
+	/* even a stale index keeps the audit results of unchanged sets */
+	while (h.count-- && fread(&e,sizeof(e),1,f)==1)
 	{
-		struct dirent *actual=readdir(d);
-		while(actual)
+		e.name[sizeof(e.name)-1]=0;
+		if ((i=driver_find(e.name,strlen(e.name)))<0)
+			continue;
+		rom_status[i]=(e.status>ROM_BAD) ? ROM_PRESENT : e.status;
+		rom_mtime[i]=e.mtime;
+		rom_size[i]=e.size;
+		if (rom_status[i]!=ROM_VERIFIED && rom_status[i]!=ROM_BAD)
+			continue;
+		/* the directory stamp doesn't cover what's inside a set */
+		sprintf(path,"%s/%s.zip",rom_scandir,e.name);
+		if (rom_set_stat(path,1,&mtime,&size)!=0)
 		{
-			for (i=0;i<NUMGAMES;i++)
+			sprintf(path,"%s/%s",rom_scandir,e.name);
+			if (rom_set_stat(path,0,&mtime,&size)!=0)
 			{
-				if (drivers[i].available==0)
-				{
-					sprintf(game,"%s.zip",drivers[i].name);
-					
-					if (strcmp(actual->d_name,game)==0)
-					{
-						drivers[i].available=1;
-						game_num_avail++;
-						break;
-					}
-				}
+				/* gone, or a name in another case: let the scan sort it out */
+				fresh=0;
+				continue;
 			}
-			actual=readdir(d);
 		}
-		closedir(d);
+		if (mtime!=rom_mtime[i] || size!=rom_size[i])
+		{
+			rom_status[i]=ROM_PRESENT;
+			rom_mtime[i]=mtime;
+			rom_size[i]=size;
+			rom_index_dirty=1;
+		}
 	}
-	
-	if (game_num_avail)
+	fclose(f);
+	return fresh;
+}
+
+static void game_list_save_index(void)
+{
+	char text[512], tmp[512];
+	struct romidx_header h;
+	struct romidx_entry e;
+	FILE *f;
+	int i, ok;
+	memset(&h,0,sizeof(h));
+	h.magic=ROMIDX_MAGIC;
+	h.version=ROMIDX_VERSION;
+	h.dir_dev=rom_scandir_st.st_dev;
+	h.dir_ino=rom_scandir_st.st_ino;
+	h.dir_mtime=rom_scandir_st.st_mtime;
+	strncpy(h.romdir,rom_scandir,sizeof(h.romdir)-1);
+	for (i=0;i<NUMGAMES;i++)
+		if (rom_status[i]!=ROM_MISSING)
+			h.count++;
+
+	sprintf(text,"%s/frontend/mame.idx",mamedir);
+	sprintf(tmp,"%s.tmp",text);
+	f=fopen(tmp,"wb");
+	if (!f)
+		return;
+	ok=(fwrite(&h,sizeof(h),1,f)==1);
+	for (i=0;i<NUMGAMES && ok;i++)
 	{
-		sprintf(text,"%s/frontend/mame.lst",mamedir);
-		remove(text);
-		/* sync(); */
-		f=fopen(text,"w");
-		if (f)
+		if (rom_status[i]==ROM_MISSING)
+			continue;
+		memset(&e,0,sizeof(e));
+		strcpy(e.name,drivers[i].name);
+		e.mtime=rom_mtime[i];
+		e.size=rom_size[i];
+		e.status=rom_status[i];
+		ok=(fwrite(&e,sizeof(e),1,f)==1);
+	}
+	if (fclose(f)!=0 || !ok || rename(tmp,text)!=0)
+		remove(tmp);
+	else
+		rom_index_dirty=0;
+}
+
+/* one pass over the directory; <name>.zip files and <name> directories count */
+static void game_list_scan(void)
+{
+	static unsigned char found[NUMGAMES];
+	char path[1024];
+	struct dirent *actual;
+	unsigned int mtime, size;
+	int i, len, zip;
+	DIR *d;
+	memset(found,0,sizeof(found));
+	d=opendir(rom_scandir);
+	if (d)
+	{
+		while ((actual=readdir(d))!=0)
 		{
-			for (i=0;i<NUMGAMES;i++)
+			len=strlen(actual->d_name);
+			zip=(len>4 && strcasecmp(actual->d_name+len-4,".zip")==0);
+			if ((i=driver_find(actual->d_name,zip ? len-4 : len))<0 || found[i])
+				continue;
+			sprintf(path,"%s/%s",rom_scandir,actual->d_name);
+			if (rom_set_stat(path,zip,&mtime,&size)!=0)
+				continue;
+			found[i]=1;
+			if (rom_status[i]==ROM_MISSING || rom_mtime[i]!=mtime || rom_size[i]!=size)
 			{
-				fputc(drivers[i].available,f);
+				rom_status[i]=ROM_PRESENT;
+				rom_mtime[i]=mtime;
+				rom_size[i]=size;
 			}
-			fclose(f);
-			/* sync(); */
 		}
+		closedir(d);
 	}
+	for (i=0;i<NUMGAMES;i++)
+		if (!found[i])
+			rom_status[i]=ROM_MISSING;
+	rom_index_dirty=1;
 }
 
-static void game_list_init_cache(void)
+static void game_list_init(void)
 {
-	char text[512];
-	FILE *f;
 	int i;
-	sprintf(text,"%s/frontend/mame.lst",mamedir);
-	f=fopen(text,"r");
-	if (f)
+	driver_hash_init();
+	memset((void *)rom_status,0,sizeof(rom_status));
+	if (strlen(romdir))
+		strcpy(rom_scandir,romdir);
+	else
+		sprintf(rom_scandir,"%s/roms",mamedir);
+
+	if (stat(rom_scandir,&rom_scandir_st)==0)
 	{
-		for (i=0;i<NUMGAMES;i++)
+		if (!game_list_load_index())
 		{
-			drivers[i].available=fgetc(f);
-			if (drivers[i].available)
-				game_num_avail++;
+			game_list_scan();
+			game_list_save_index();
 		}
-		fclose(f);
 	}
-	else
-		game_list_init_nocache();
+
+	game_num_avail=0;
+	for (i=0;i<NUMGAMES;i++)
+	{
+		drivers[i].available=(rom_status[i]!=ROM_MISSING);
+		if (drivers[i].available)
+			game_num_avail++;
+	}
 }
 
-static void game_list_init(int argc)
+/* ROM_VERIFIED or ROM_BAD, -1 if the check couldn't be run or crashed */
+static int game_list_audit_run(int i)
 {
-	if (argc==1)
-		game_list_init_nocache();
-	else
-		game_list_init_cache();
+	char *args[10];
+	int n=0, fd, status;
+	pid_t pid;
+	args[n]=drivers[i].exe; n++;
+	args[n]=(char *)"-headless"; n++;
+	args[n]=(char *)"-verifyroms"; n++;
+	args[n]=drivers[i].name; n++;
+	args[n]=(char *)"-mamepath"; n++;
+	args[n]=mamedir; n++;
+	args[n]=(char *)"-rompath"; n++;
+	args[n]=rom_scandir; n++;
+	args[n]=NULL;
+
+	if (audit_quit)
+		return -1;
+	pid=fork();
+	if (pid<0)
+		return -1;
+	if (pid==0)
+	{
+		fd=open("/dev/null",O_WRONLY);
+		if (fd>=0)
+		{
+			dup2(fd,1);
+			dup2(fd,2);
+		}
+		execv(args[0],args);
+		_exit(127);
+	}
+	/* game_list_close() sets audit_quit, then reads audit_pid: one of */
+	/* the two sides sees the other's write and kills the child */
+	audit_pid=pid;
+	__sync_synchronize();
+	if (audit_quit)
+		kill(pid,SIGTERM);
+	while (waitpid(pid,&status,0)<0 && errno==EINTR)
+		;
+	audit_pid=0;
+	if (audit_quit || !WIFEXITED(status))
+		return -1;
+	/* frontend_help(): 0 good, 1 not found, 2 bad */
+	switch (WEXITSTATUS(status))
+	{
+		case 0: return ROM_VERIFIED;
+		case 1: case 2: return ROM_BAD;
+	}
+	return -1;
+}
+
+static int game_list_audit_func(void *data)
+{
+	int i, res;
+	for (i=0;i<NUMGAMES && !audit_quit;i++)
+	{
+		if (rom_status[i]!=ROM_PRESENT)
+			continue;
+		/* a set that crashes -verifyroms stays unaudited, the rest go on */
+		if ((res=game_list_audit_run(i))<0)
+			continue;
+		rom_status[i]=res;
+		rom_index_dirty=1;
+	}
+	return 0;
+}
+
+static void game_list_audit_start(void)
+{
+	audit_quit=0;
+	audit_thread=SDL_CreateThread(game_list_audit_func,"audit",0);
+}
+
+/* stop the audit and write back anything it found */
+static void game_list_close(void)
+{
+	if (audit_thread)
+	{
+		audit_quit=1;
+		__sync_synchronize();
+		if (audit_pid)
+			kill(audit_pid,SIGTERM);
+		SDL_WaitThread(audit_thread,0);
+		audit_thread=0;
+	}
+	if (rom_index_dirty)
+		game_list_save_index();
 }
 
 static void game_list_view(int *pos) {
@@ -301,6 +607,8 @@ static void game_list_view(int *pos) {
 		if (drivers[i].available==1) {
 			if (aux_pos>=view_pos && aux_pos<=view_pos+21) { // ALEK 20
 				odx_gamelist_text_out( screen_x, screen_y, drivers[i].description);
+				if (rom_status[i]==ROM_BAD)
+					odx_gamelist_text_out( screen_x-30, screen_y,"!" );
 				if (aux_pos==*pos) {
 					odx_gamelist_text_out( screen_x-10, screen_y,">" );
 					odx_gamelist_text_out( screen_x-13, screen_y-1,"-" );
@@ -615,11 +923,7 @@ static int show_options(char *game)
 
 static void odx_exit(char *param)
 {
-	char text[512];
-	
-	sprintf(text,"%s/frontend/mame.lst",mamedir);
-	remove(text);
-	/* sync(); */
+	game_list_close();
 	odx_deinit();
 	
 	exit(0);
@@ -689,6 +993,11 @@ void execute_game (char *playemu, char *playgame)
     {
  		args[n]="-fullscreen"; n++;
     }
+	/* handed back when the emulator returns to the frontend */
+	if (rom_audit)
+	{
+		args[n]="-audit"; n++;
+	}
 	/* odx_video_depth */
 	if (odx_video_depth==8)
 	{
@@ -1088,6 +1397,8 @@ int main (int argc, char **argv)
 	{
 		if (strcasecmp(argv[i],"-fullscreen") == 0)
 			fullscreen=true;
+		if (strcasecmp(argv[i],"-audit") == 0)
+			rom_audit=1;
 	}
     
 	/* get initial home directory */
@@ -1110,7 +1421,7 @@ int main (int argc, char **argv)
 	}
 
 	/* Initialize list of available games */
-	game_list_init(argc);
+	game_list_init();
 	if (game_num_avail==0)
 	{
 		/* save current dir */
@@ -1125,14 +1436,18 @@ int main (int argc, char **argv)
 			if (get_romdir(romdir) == -1)
 				odx_exit("");
 			else
-				game_list_init(argc);
+				game_list_init();
 		}
 		/* go back to default dir to avoid issue when launching mame after */
 		chdir(curDir);
 	}
 
+	if (rom_audit)
+		game_list_audit_start();
+
 	/* Select Game */
 	select_game(playemu,playgame); 
+	game_list_close();
 
 	/* Write default configuration */
 	f=fopen(text,"w");
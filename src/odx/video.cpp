@@ -1,5 +1,6 @@
 #include "driver.h"
 #include <math.h>
+#include <ctype.h>
 #include "vidhrdw/vector.h"
 #include "dirty.h"
 
@@ -36,7 +37,9 @@ static int dirty_bright;
 static int bright_lookup[256];
 
 extern UINT32 *palette_16bit_lookup;
-extern unsigned int odx_video_regulator;
+extern int palette_16bit_lookup_len;
+extern void blit_thread_stop(void);
+extern void blit_init(void);
 
 int frameskip,autoframeskip;
 #define FRAMESKIP_LEVELS 12
@@ -86,6 +89,14 @@ static int frameskip_counter;
 
 #define vsync() odx_video_wait_vsync()
 
+int bench_seconds = 0;	/* -bench: stop after this many emulated seconds */
+FILE *bench_csv = 0;	/* -benchcsv: append one row per run */
+FILE *bench_json = 0;	/* -benchjson: append one JSON object per line */
+static int bench_frames;
+static TICKER bench_start,bench_wall;
+
+extern bool ui_exit;
+
 #define makecol(r,g,b) ((((r)&0xF8)<<8)|(((g)&0xFC)<<3)|(((b)&0xF8)>>3))
 #define getr(c) (((c)>>8)&0xF8)
 #define getg(c) (((c)>>3)&0xFC)
@@ -191,8 +202,6 @@ void osd_mark_dirty(int _x1, int _y1, int _x2, int _y2, int ui)
 	}
 }
 
-#define osd_mark_dirty(x1,y1,x2,y2,ui) 
-
 /* set the bitmap to black */
 void osd_clearbitmap(struct osd_bitmap *bitmap)
 {
@@ -235,7 +244,7 @@ void osd_free_bitmap(struct osd_bitmap *bitmap)
 
 static void init_dirty(char dirty)
 {
-	memset(dirty_new, dirty, MAX_GFX_WIDTH/16 * MAX_GFX_HEIGHT/16);
+	memset(dirty_new, dirty, sizeof(dirtygrid));
 }
 
 INLINE void swap_dirty(void)
@@ -392,6 +401,8 @@ int osd_create_display(int width,int height,int depth,int fps,int attributes,int
 	video_depth = depth;
 	video_fps = fps;
 
+	blit_init();
+
 	brightness = 100;
 	brightness_paused_adjust = 1.0;
 	dirty_bright = 1;
@@ -399,6 +410,13 @@ int osd_create_display(int width,int height,int depth,int fps,int attributes,int
 	if (frameskip < 0) frameskip = 0;
 	if (frameskip >= FRAMESKIP_LEVELS) frameskip = FRAMESKIP_LEVELS-1;
 
+	if (bench_seconds)
+	{
+		/* the profiler buckets are the per-subsystem part of the report */
+		bench_frames = 0;
+		profiler_start();
+	}
+
 	/* Look if this is a vector game */
 	if (attributes & VIDEO_TYPE_VECTOR)
 		vector_game = 1;
@@ -458,7 +476,8 @@ int osd_set_display(int width,int height,int depth,int attributes,int orientatio
 		dirtypalette = 1;
 	}
 
-	/* Set video mode */
+	/* Set video mode, the render thread must not touch the old texture */
+	blit_thread_stop();
 	odx_set_video_mode(depth,width,height);
 
 	vsync_frame_rate = video_fps;
@@ -515,12 +534,14 @@ int osd_set_display(int width,int height,int depth,int attributes,int orientatio
 /* shut up the display */
 void osd_close_display(void)
 {
+	blit_thread_stop();
 	free(dirtycolor);
 	dirtycolor = 0;
 	free(current_palette);
 	current_palette = 0;
 	free(palette_16bit_lookup);
 	palette_16bit_lookup = 0;
+	palette_16bit_lookup_len = 0;
 }
 
 int osd_allocate_colors(unsigned int totalcolors,const unsigned char *palette,unsigned short *pens,int modifiable)
@@ -538,6 +559,7 @@ int osd_allocate_colors(unsigned int totalcolors,const unsigned char *palette,un
 	palette_16bit_lookup = (UINT32*)malloc(screen_colors * sizeof(palette_16bit_lookup[0]));
 	if (dirtycolor == 0 || current_palette == 0 || palette_16bit_lookup == 0)
 		return 1;
+	palette_16bit_lookup_len = screen_colors;
 
 	for (i = 0;i < screen_colors;i++)
 		dirtycolor[i] = 1;
@@ -820,6 +842,19 @@ void osd_update_video_and_audio(struct osd_bitmap *bitmap)
 	if (frameskip_counter == 0)
 		this_frame_base = prev_measure + FRAMESKIP_LEVELS * TICKS_PER_SEC/video_fps;
 
+	if (bench_seconds && !ui_exit)
+	{
+		/* wall time is measured from the first frame, so ROM loading and */
+		/* gfx decoding are not part of the result */
+		if (bench_frames == 0)
+			bench_start = ticker();
+		if (++bench_frames >= bench_seconds * video_fps)
+		{
+			bench_wall = ticker() - bench_start;
+			ui_exit = true;
+		}
+	}
+
 	/* update audio */
 	msdos_update_audio();
 
@@ -852,29 +887,34 @@ void osd_update_video_and_audio(struct osd_bitmap *bitmap)
 		}
 
 		/* now wait until it's time to update the screen */
-		//if (throttle)
-		//{
+		if (throttle)
+		{
 			profiler_mark(PROFILER_IDLE);
             
-   /*         
 			{
-				static TICKER last;
-				do
+				/* pace on an absolute deadline at the driver's real frame */
+				/* rate so sleep overshoot doesn't accumulate; the audio rate */
+				/* control absorbs what is left. waittable accounts for the */
+				/* frames skipped since the last displayed one. */
+				static TICKER target = ticker();
+				static float frac;
+				int step, delay;
+
+				frac += waittable[frameskip][frameskip_counter] * TICKS_PER_SEC / Machine->drv->frames_per_second;
+				step = (int)frac;
+				frac -= step;
+				target += step;
+
+				curr = ticker();
+				delay = (int)(target - curr);
+				if (delay > 0)
 				{
-                 //   vsync();
+					usleep(delay);
 					curr = ticker();
-                    usleep(2000);
-				} while (TICKS_PER_SEC / (curr - last) > video_fps * odx_video_regulator /1000);
-				last = curr;
+				}
+				else if (delay < -4 * step)
+					target = curr;	/* fell far behind, don't try to catch up */
 			}
-     */       
-            {
-				static TICKER last = ticker();
-                curr = ticker();
-                long delay = ((TICKS_PER_SEC*1000) / (video_fps * odx_video_regulator)) - (curr - last);
-                if(delay > 0) usleep(delay);
-				last = ticker();
-			}  
             /*
 				TICKER target;
 
@@ -919,8 +959,8 @@ void osd_update_video_and_audio(struct osd_bitmap *bitmap)
       */
       
 		  profiler_mark(PROFILER_END);
-		//}
-		//else curr = ticker();
+		}
+		else curr = ticker();
 
 		if (frameskip_counter == 0)
 		{
@@ -971,6 +1011,8 @@ void osd_update_video_and_audio(struct osd_bitmap *bitmap)
 			}
 			if (dirtypalette)
 			{
+				if (use_dirty) init_dirty(1);	/* have to redraw the whole screen */
+
 				dirtypalette = 0;
 				for (i = 0;i < screen_colors;i++)
 				{
@@ -1147,6 +1189,144 @@ void osd_update_video_and_audio(struct osd_bitmap *bitmap)
 
 
 
+/* profiler bucket name usable as a CSV column / JSON key */
+static const char *bench_key(int type)
+{
+	static char key[PROFILER_TOTAL][16];
+	char *d = key[type];
+	const char *n = profiler_get_name(type);
+
+	if (d[0] == 0)
+	{
+		for (;*n && d < key[type] + 15;n++)
+			if (*n != ' ') *d++ = tolower(*n);
+		*d = 0;
+	}
+	return key[type];
+}
+
+/* CSV header, only for a new file so runs can be appended */
+void osd_bench_header(void)
+{
+	int i;
+
+	fseek(bench_csv,0,SEEK_END);
+	if (ftell(bench_csv) == 0)
+	{
+		fprintf(bench_csv,"game,status,cpu_types,emulated_s,wall_s,speed");
+		for (i = 0;i < PROFILER_TOTAL;i++)
+			fprintf(bench_csv,",%s",bench_key(i));
+		fprintf(bench_csv,"\n");
+		fflush(bench_csv);
+	}
+}
+
+/* print the -bench result: emulated vs wall time and the profiler breakdown. */
+/* status is "ok" or "failed" when the game didn't start; a run that ended */
+/* early reports what it got as "incomplete". Crashes and hangs are written */
+/* by distrib/bench.sh */
+void osd_bench_report(const char *status)
+{
+	UINT64 counts[PROFILER_TOTAL];
+	UINT64 total,normalize;
+	unsigned int switches;
+	float emulated,wall,speed;
+	int i;
+	static int reported;
+
+	if (reported) return;
+	reported = 1;
+
+	memset(counts,0,sizeof(counts));
+	total = normalize = 0;
+	switches = 0;
+	emulated = wall = speed = 0;
+
+	if (bench_frames > 0)
+	{
+		if (bench_wall == 0)
+		{
+			bench_wall = ticker() - bench_start;
+			if (strcmp(status,"ok") == 0)
+				status = "incomplete";
+		}
+
+		profiler_stop();
+		profiler_get_totals(counts,&switches);
+
+		for (i = 0;i < PROFILER_PROFILER;i++)
+			normalize += counts[i];
+		total = normalize;
+		for (;i < PROFILER_TOTAL;i++)
+			total += counts[i];
+
+		emulated = (float)bench_frames / video_fps;
+		wall = (float)bench_wall / TICKS_PER_SEC;
+		if (wall > 0)
+			speed = 100.0f * emulated / wall;
+
+		printf("bench: %s %d frames, %.2f emulated s, %.2f wall s, %.1f%% speed, %.1f fps\n",
+				Machine->gamedrv->name,bench_frames,emulated,wall,
+				speed,wall > 0 ? bench_frames / wall : 0);
+	}
+	else if (strcmp(status,"ok") == 0)
+		status = "failed";
+	if (strcmp(status,"ok") != 0)
+		printf("bench: %s %s\n",Machine->gamedrv->name,status);
+
+	/* same columns as the on screen profiler: % of total, % excluding idle */
+	for (i = 0;i < PROFILER_TOTAL && normalize;i++)
+	{
+		if (counts[i] == 0) continue;
+		if (i < PROFILER_PROFILER)
+			printf("bench: %s %5.1f%% %5.1f%%\n",profiler_get_name(i),
+					100.0f * counts[i] / total,100.0f * counts[i] / normalize);
+		else
+			printf("bench: %s %5.1f%%\n",profiler_get_name(i),
+					100.0f * counts[i] / total);
+	}
+	if (bench_frames > 0)
+		printf("bench: CPU switches %d per frame\n",switches / bench_frames);
+
+	if (bench_csv || bench_json)
+	{
+		char cpus[128];
+
+		/* emulated CPU types, e.g. "68000+Z80" */
+		cpus[0] = 0;
+		for (i = 0;i < MAX_CPU;i++)
+		{
+			int type = Machine->drv->cpu[i].cpu_type & ~CPU_FLAGS_MASK;
+			if (type == CPU_DUMMY) continue;
+			if (cpus[0]) strcat(cpus,"+");
+			strncat(cpus,cputype_name(type),sizeof(cpus) - strlen(cpus) - 2);
+		}
+
+		if (bench_csv)
+		{
+			osd_bench_header();
+			fprintf(bench_csv,"%s,%s,%s,%.3f,%.3f,%.2f",Machine->gamedrv->name,status,cpus,
+					emulated,wall,speed);
+			for (i = 0;i < PROFILER_TOTAL;i++)
+				fprintf(bench_csv,",%.2f",total ? 100.0f * counts[i] / total : 0);
+			fprintf(bench_csv,"\n");
+			fflush(bench_csv);
+		}
+
+		if (bench_json)
+		{
+			fprintf(bench_json,"{\"game\":\"%s\",\"status\":\"%s\",\"cpu_types\":\"%s\",\"emulated_s\":%.3f,\"wall_s\":%.3f,\"speed\":%.2f,\"profile\":{",
+					Machine->gamedrv->name,status,cpus,emulated,wall,speed);
+			for (i = 0;i < PROFILER_TOTAL;i++)
+				fprintf(bench_json,"%s\"%s\":%.2f",i ? "," : "",bench_key(i),total ? 100.0f * counts[i] / total : 0);
+			fprintf(bench_json,"}}\n");
+			fflush(bench_json);
+		}
+	}
+}
+
+
+
 void osd_set_gamma(float _gamma)
 {
 	int i;
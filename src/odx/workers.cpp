@@ -0,0 +1,189 @@
+/*
+ * Worker pool for osd_parallel_for().
+ *
+ * One thread per extra core is started the first time there is work, and
+ * kept until osd_exit(). The calling thread takes chunks too, so with a
+ * single core everything simply runs inline.
+ *
+ * osd_background_start() is separate: one low priority thread per job.
+ */
+
+#include "driver.h"
+#include "minimal.h"
+
+#define MAX_WORKERS 8
+
+int worker_threads = -1;	/* -threads N, -1 = one per core */
+
+static SDL_Thread *worker_thread[MAX_WORKERS];
+static int worker_count = -1;	/* -1 = pool not started yet */
+static SDL_mutex *worker_lock;
+static SDL_cond *worker_wake;
+static SDL_cond *worker_done;
+static int worker_generation;
+static int worker_busy;
+static int worker_quit;
+
+static void (*job_func)(void *param,int start,int end);
+static void *job_param;
+static int job_count;
+static int job_chunk;
+static volatile int job_next;
+
+void workers_stop(void);
+
+static void worker_run_chunks(void)
+{
+	int start;
+
+	while ((start = __sync_fetch_and_add(&job_next,job_chunk)) < job_count)
+	{
+		int end = start + job_chunk;
+		if (end > job_count) end = job_count;
+		job_func(job_param,start,end);
+	}
+}
+
+static int worker_func(void *data)
+{
+	int seen = 0;
+
+	SDL_LockMutex(worker_lock);
+	for (;;)
+	{
+		while (seen == worker_generation && !worker_quit)
+			SDL_CondWait(worker_wake, worker_lock);
+		if (worker_quit) break;
+		seen = worker_generation;
+		SDL_UnlockMutex(worker_lock);
+
+		worker_run_chunks();
+
+		SDL_LockMutex(worker_lock);
+		if (--worker_busy == 0)
+			SDL_CondSignal(worker_done);
+	}
+	SDL_UnlockMutex(worker_lock);
+	return 0;
+}
+
+static void workers_start(void)
+{
+	int n = worker_threads;
+
+	worker_count = 0;
+	if (n < 0)
+		n = SDL_GetCPUCount();
+	n--;	/* the caller is one of them */
+	if (n > MAX_WORKERS) n = MAX_WORKERS;
+	if (n <= 0) return;
+
+	worker_lock = SDL_CreateMutex();
+	worker_wake = SDL_CreateCond();
+	worker_done = SDL_CreateCond();
+	if (!worker_lock || !worker_wake || !worker_done)
+	{
+		workers_stop();
+		worker_count = 0;
+		return;
+	}
+
+	worker_quit = 0;
+	while (worker_count < n)
+	{
+		if ((worker_thread[worker_count] = SDL_CreateThread(worker_func, "worker", 0)) == 0)
+			break;
+		worker_count++;
+	}
+	logerror("%d worker threads started\n",worker_count);
+}
+
+void workers_stop(void)
+{
+	int i;
+
+	if (worker_lock)
+	{
+		SDL_LockMutex(worker_lock);
+		worker_quit = 1;
+		SDL_CondBroadcast(worker_wake);
+		SDL_UnlockMutex(worker_lock);
+	}
+	for (i = 0; i < worker_count; i++)
+		SDL_WaitThread(worker_thread[i], 0);
+
+	if (worker_done) SDL_DestroyCond(worker_done);
+	if (worker_wake) SDL_DestroyCond(worker_wake);
+	if (worker_lock) SDL_DestroyMutex(worker_lock);
+	worker_done = worker_wake = 0;
+	worker_lock = 0;
+	worker_count = -1;
+}
+
+int osd_parallel_workers(void)
+{
+	if (worker_count < 0)
+		workers_start();
+	return worker_count + 1;
+}
+
+void osd_parallel_for(int count,void (*func)(void *param,int start,int end),void *param)
+{
+	if (count <= 0) return;
+	if (worker_count < 0)
+		workers_start();
+	if (worker_count == 0 || count == 1)
+	{
+		func(param,0,count);
+		return;
+	}
+
+	/* a few chunks per thread, so an unlucky slow chunk doesn't hold everyone up */
+	job_func = func;
+	job_param = param;
+	job_count = count;
+	job_chunk = count / ((worker_count + 1) * 4);
+	if (job_chunk < 1) job_chunk = 1;
+	job_next = 0;
+
+	SDL_LockMutex(worker_lock);
+	worker_busy = worker_count;
+	worker_generation++;
+	SDL_CondBroadcast(worker_wake);
+	SDL_UnlockMutex(worker_lock);
+
+	worker_run_chunks();
+
+	SDL_LockMutex(worker_lock);
+	while (worker_busy)
+		SDL_CondWait(worker_done, worker_lock);
+	SDL_UnlockMutex(worker_lock);
+}
+
+static SDL_Thread *background_thread;
+static void (*background_func)(void *param);
+static void *background_param;
+
+static int background_run(void *data)
+{
+	/* emulation, sound and the render thread come first */
+	SDL_SetThreadPriority(SDL_THREAD_PRIORITY_LOW);
+	background_func(background_param);
+	return 0;
+}
+
+int osd_background_start(void (*func)(void *param),void *param)
+{
+	osd_background_wait();
+	background_func = func;
+	background_param = param;
+	background_thread = SDL_CreateThread(background_run, "background", 0);
+	return background_thread != 0;
+}
+
+void osd_background_wait(void)
+{
+	if (background_thread)
+		SDL_WaitThread(background_thread, 0);
+	background_thread = 0;
+}
@@ -272,6 +272,7 @@ enum
 	OSD_FILETYPE_HISTORY,  /* LBO 040400 */
 	OSD_FILETYPE_CHEAT,  /* LBO 040400 */
 	OSD_FILETYPE_LANGUAGE, /* LBO 042400 */
+	OSD_FILETYPE_IDLE,
 #ifdef MESS
 	OSD_FILETYPE_IMAGE_R,
 	OSD_FILETYPE_IMAGE_RW,
@@ -306,6 +307,15 @@ void osd_fclose(void *file);
 int osd_fchecksum(const char *gamename, const char *filename, unsigned int *length, unsigned int *sum);
 int osd_fsize(void *file);
 unsigned int osd_fcrc(void *file);
+/* ROMs are only located by osd_fopen(). This reads (and checksums) the given */
+/* ones concurrently; if dest[i] is set, file i is read straight into it, */
+/* and an osd_fread() of it into that same place then copies nothing. */
+void osd_fload(void **files, unsigned char **dest, int count);
+/* map a ROM, before osd_fload(), as osd_fsize() bytes of private */
+/* (copy-on-write) memory. 0 if the file can't be mapped. The mapping */
+/* outlives the file and is released with osd_funmap(). */
+void *osd_fmap(void *file);
+void osd_funmap(void *base, int length);
 /* LBO 040400 - start */
 int osd_fgetc(void *file);
 int osd_ungetc(int c, void *file);
@@ -314,12 +324,33 @@ int osd_feof(void *file);
 int osd_ftell(void *file);
 /* LBO 040400 - end */
 
+/* decoded gfx cache. load returns 0 if there is no valid entry for key; */
+/* elements it returns must be released with osd_gfxcache_free(). */
+struct GfxElement;
+struct GfxElement *osd_gfxcache_load(const char *gamename,int num,unsigned int key);
+void osd_gfxcache_save(const char *gamename,int num,unsigned int key,const struct GfxElement *gfx);
+void osd_gfxcache_free(struct GfxElement *gfx);
+
 /******************************************************************************
 
   Miscellaneous
 
 ******************************************************************************/
 
+/* run func over [0,count) split into chunks, on as many cores as there are. */
+/* Returns when every chunk is done. Call from the main thread only. */
+void osd_parallel_for(int count,void (*func)(void *param,int start,int end),void *param);
+/* number of threads osd_parallel_for() spreads work over, 1 if none */
+int osd_parallel_workers(void);
+/* run func(param) on a low priority thread while emulation goes on. One job */
+/* at a time; returns 0 if it couldn't start, and then func was not called. */
+/* osd_background_wait() returns once func has. */
+int osd_background_start(void (*func)(void *param),void *param);
+void osd_background_wait(void);
+/* non-zero if the NEON/SSE2 kernels were built in and not turned off */
+/* with -nosimd */
+int osd_cpu_has_simd(void);
+
 /* called while loading ROMs. It is called a last time with name == 0 to signal */
 /* that the ROM loading process is finished. */
 /* return non-zero to abort loading */
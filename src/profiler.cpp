@@ -15,6 +15,37 @@ struct profile_data
 static struct profile_data profile;
 static int memory;
 
+static const char *names[PROFILER_TOTAL] =
+{
+	"CPU 1  ",
+	"CPU 2  ",
+	"CPU 3  ",
+	"CPU 4  ",
+	"CPU 5  ",
+	"CPU 6  ",
+	"CPU 7  ",
+	"CPU 8  ",
+	"Video  ",
+	"drawgfx",
+	"copybmp",
+	"tmupdat",
+	"tmrendr",
+	"tmdraw ",
+	"Blit   ",
+	"Sound  ",
+	"Mixer  ",
+	"Callbck",
+	"Hiscore",
+	"Input  ",
+	"Extra  ",
+	"User1  ",
+	"User2  ",
+	"User3  ",
+	"User4  ",
+	"Profilr",
+	"Idle   ",
+};
+
 
 static int FILO_type[10];
 static unsigned int FILO_start[10];
@@ -89,37 +120,6 @@ void profiler_show(struct osd_bitmap *bitmap)
 	UINT64 computed;
 	int line;
 	char buf[30];
-	static char *names[PROFILER_TOTAL] =
-	{
-		"CPU 1  ",
-		"CPU 2  ",
-		"CPU 3  ",
-		"CPU 4  ",
-		"CPU 5  ",
-		"CPU 6  ",
-		"CPU 7  ",
-		"CPU 8  ",
-		"Video  ",
-		"drawgfx",
-		"copybmp",
-		"tmupdat",
-		"tmrendr",
-		"tmdraw ",
-		"Blit   ",
-		"Sound  ",
-		"Mixer  ",
-		"Callbck",
-		"Hiscore",
-		"Input  ",
-		"Extra  ",
-		"User1  ",
-		"User2  ",
-		"User3  ",
-		"User4  ",
-		"Profilr",
-		"Idle   ",
-	};
-
 
 	if (!use_profiler) return;
 
@@ -179,3 +179,26 @@ void profiler_show(struct osd_bitmap *bitmap)
 
 	profiler_mark(PROFILER_END);
 }
+
+/* totals over all the history slots, used by the OS layer benchmark report */
+void profiler_get_totals(UINT64 *counts,unsigned int *cpu_context_switches)
+{
+	int i,j;
+
+	for (i = 0;i < PROFILER_TOTAL;i++)
+	{
+		counts[i] = 0;
+		for (j = 0;j < MEMORY;j++)
+			counts[i] += profile.count[j][i];
+	}
+
+	*cpu_context_switches = 0;
+	for (j = 0;j < MEMORY;j++)
+		*cpu_context_switches += profile.cpu_context_switches[j];
+}
+
+const char *profiler_get_name(int type)
+{
+	if (type < 0 || type >= PROFILER_TOTAL) return "";
+	return names[type];
+}
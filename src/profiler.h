@@ -56,4 +56,8 @@ void profiler_start(void);
 void profiler_stop(void);
 void profiler_show(struct osd_bitmap *bitmap);
 
+/* functions called by the OS layer benchmark mode */
+void profiler_get_totals(UINT64 *counts,unsigned int *cpu_context_switches);
+const char *profiler_get_name(int type);
+
 #endif	/* PROFILER_H */
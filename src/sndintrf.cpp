@@ -25,7 +25,8 @@ static void soundlatch_callback(int param)
 WRITE_HANDLER( soundlatch_w )
 {
 	/* make all the CPUs synchronize, and only AFTER that write the new command to the latch */
-	timer_set(TIME_NOW,data,soundlatch_callback);
+	if (!cpu_defer(-1,soundlatch_callback,data))
+		timer_set(TIME_NOW,data,soundlatch_callback);
 }
 
 READ_HANDLER( soundlatch_r )
@@ -49,7 +50,8 @@ static void soundlatch2_callback(int param)
 WRITE_HANDLER( soundlatch2_w )
 {
 	/* make all the CPUs synchronize, and only AFTER that write the new command to the latch */
-	timer_set(TIME_NOW,data,soundlatch2_callback);
+	if (!cpu_defer(-1,soundlatch2_callback,data))
+		timer_set(TIME_NOW,data,soundlatch2_callback);
 }
 
 READ_HANDLER( soundlatch2_r )
@@ -73,7 +75,8 @@ static void soundlatch3_callback(int param)
 WRITE_HANDLER( soundlatch3_w )
 {
 	/* make all the CPUs synchronize, and only AFTER that write the new command to the latch */
-	timer_set(TIME_NOW,data,soundlatch3_callback);
+	if (!cpu_defer(-1,soundlatch3_callback,data))
+		timer_set(TIME_NOW,data,soundlatch3_callback);
 }
 
 READ_HANDLER( soundlatch3_r )
@@ -97,7 +100,8 @@ static void soundlatch4_callback(int param)
 WRITE_HANDLER( soundlatch4_w )
 {
 	/* make all the CPUs synchronize, and only AFTER that write the new command to the latch */
-	timer_set(TIME_NOW,data,soundlatch4_callback);
+	if (!cpu_defer(-1,soundlatch4_callback,data))
+		timer_set(TIME_NOW,data,soundlatch4_callback);
 }
 
 READ_HANDLER( soundlatch4_r )
@@ -114,6 +114,7 @@ static int my_YM2151_sh_start(const struct MachineSound *msound,int mode)
         			stream[i] = stream_init_multi(YM2151_NUMBUF,name,vol,rate,i,OPMUpdateOne);
             }
 #endif
+			stream_set_group(stream[i],STREAM_GROUP_YAMAHA_FM);
 		}
 		/* Set Timer handler */
 		for (i = 0; i < intf->num; i++)
@@ -90,6 +90,7 @@ int YM2203_sh_start(const struct MachineSound *msound)
 		sprintf(name,"%s #%d FM",sound_name(msound),i);
 		volume = intf->mixing_level[i]>>16; /* high 16 bit */
 		stream[i] = stream_init(name,volume,Machine->sample_rate,i,YM2203UpdateOne/*YM2203UpdateCallback*/);
+		stream_set_group(stream[i],STREAM_GROUP_YAMAHA_FM);
 	}
 	/* Initialize FM emurator */
 	if (YM2203Init(intf->num,intf->baseclock,Machine->sample_rate,TimerHandler,IRQHandler) == 0)
@@ -134,6 +134,7 @@ int YM2608_sh_start(const struct MachineSound *msound)
 			sprintf(buf[j],"%s #%d Ch%d",sound_name(msound),i,j+1);
 		}
 		stream[i] = stream_init_multi(YM2608_NUMBUF,name,vol,rate,i,YM2608UpdateOne);
+		stream_set_group(stream[i],STREAM_GROUP_YAMAHA_FM);
 		/* setup adpcm buffers */
 		pcmbufa[i]  = (void *)(memory_region(intf->pcmrom[i]));
 		pcmsizea[i] = memory_region_length(intf->pcmrom[i]);
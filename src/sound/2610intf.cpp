@@ -113,6 +113,7 @@ int YM2610_sh_start(const struct MachineSound *msound)
 			sprintf(buf[j],"%s #%d Ch%d",sound_name(msound),i,j+1);
 		}
 		stream[i] = stream_init_multi(YM2610_NUMBUF,name,vol,rate,i,YM2610UpdateOne);
+		stream_set_group(stream[i],STREAM_GROUP_YAMAHA_FM);
 		/* setup adpcm buffers */
 		pcmbufa[i]  = (void *)(memory_region(intf->pcmroma[i]));
 		pcmsizea[i] = memory_region_length(intf->pcmroma[i]);
@@ -163,6 +164,7 @@ int YM2610B_sh_start(const struct MachineSound *msound)
 			sprintf(buf[j],"%s #%d Ch%d",sound_name(msound),i,j+1);
 		}
 		stream[i] = stream_init_multi(YM2610_NUMBUF,name,vol,rate,i,YM2610BUpdateOne);
+		stream_set_group(stream[i],STREAM_GROUP_YAMAHA_FM);
 		/* setup adpcm buffers */
 		pcmbufa[i]  = (void *)(memory_region(intf->pcmroma[i]));
 		pcmsizea[i] = memory_region_length(intf->pcmroma[i]);
@@ -123,6 +123,7 @@ int YM2612_sh_start(const struct MachineSound *msound)
 		stream[i] = stream_init_multi(YM2612_NUMBUF,
 			name,vol,rate,
 			i,YM2612UpdateOne);
+		stream_set_group(stream[i],STREAM_GROUP_YAMAHA_FM);
 	}
 
 	/**** initialize YM2612 ****/
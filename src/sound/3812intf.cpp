@@ -344,6 +344,7 @@ static int emu_YM3812_sh_start(const struct MachineSound *msound)
 		else
 #endif
 		stream[i] = stream_init(name,vol,rate,i,YM3812UpdateHandler);
+		stream_set_group(stream[i],STREAM_GROUP_YAMAHA_FM);
 		/* YM3812 setup */
 		OPLSetTimerHandler(F3812[i],TimerHandler,i*2);
 		OPLSetIRQHandler(F3812[i]  ,IRQHandler,i);
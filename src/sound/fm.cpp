@@ -381,6 +381,12 @@ static UINT32 LFOCnt,LFOIncr;	/* LFO PhaseGenerator */
 static INT32 out_ch[4];		/* channel output NONE,LEFT,RIGHT or CENTER */
 static INT32 pg_in1,pg_in2,pg_in3,pg_in4;	/* PG input of SLOTs */
 
+/* OPN block engine, see OPN_CALC_BLOCK() */
+int fm_block = 1;	/* -nofmblock: FM_CALC_CH() a sample at a time */
+int fm_check;		/* -fmcheck: run both engines and compare */
+static int fm_check_blocks,fm_check_bad;
+static UINT32 fm_check_time[2];	/* us in FM_CALC_CH() , OPN_CALC_BLOCK() */
+
 /* -------------------- log output  -------------------- */
 /* log output level */
 #define LOG_ERR  3      /* ERROR       */
@@ -1026,6 +1032,11 @@ static int FMInitTable( void )
 
 static void FMCloseTable( void )
 {
+	if( fm_check_blocks )
+		logerror("fmcheck: %d blocks, %d mismatched, per sample %u us, block %u us\n",
+			fm_check_blocks,fm_check_bad,fm_check_time[0],fm_check_time[1]);
+	fm_check_blocks = fm_check_bad = 0;
+	fm_check_time[0] = fm_check_time[1] = 0;
 	if( TL_TABLE ) free( TL_TABLE );
 	TL_TABLE = 0;
 	return;
@@ -1383,6 +1394,405 @@ static void OPNWriteReg(FM_OPN *OPN, int r, int v)
 		break;
 	}
 }
+
+/* ---------- block engine ---------- */
+/* FM_CALC_CH() does one channel for one sample, mostly loading and storing
+   slot state. Phase and envelope never depend on the operator outputs, so
+   OPN_CALC_BLOCK() first runs them for a block of samples with the four
+   slots of a channel side by side in a vector, then walks the block once
+   more for the connections, which are serial within a channel. A channel
+   with every slot under the cut off level for the whole block only needs
+   the first part. The output is bit exact with FM_CALC_CH(); -fmcheck runs
+   both and compares. Without vectors two passes cost more than they save,
+   so the update loops keep FM_CALC_CH() there. */
+
+#define FM_BLOCK 64
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define FM_SIMD "NEON"
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define FM_SIMD "SSE2"
+#endif
+
+#ifdef FM_SIMD
+
+#define FM_BLOCK_ON (fm_block && osd_cpu_has_simd())
+
+static INT32 blk_out[4][FM_BLOCK];	/* FM output of the block by PAN */
+static UINT32 blk_pg[FM_BLOCK][4];	/* Cnt of each SLOT[] */
+static UINT32 blk_eg[FM_BLOCK][4];	/* envelope output of each SLOT[] */
+static UINT32 blk_amd[FM_BLOCK];	/* lfo_amd */
+static INT32 blk_pmd[FM_BLOCK];		/* lfo_pmd */
+static INT32 blk_pms[FM_BLOCK];		/* lfo_pmd scaled by the channel PMS */
+
+/* the divisions by PMS_RATE and LFO_RATE become shifts */
+#define PMS_BITS 10
+#define LFO_BITS 16
+#if (1<<PMS_BITS) != PMS_RATE || (1<<LFO_BITS) != LFO_RATE
+#error PMS_BITS or LFO_BITS is wrong
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+
+typedef uint32x4_t vec32;
+
+#define vec32_load(P)		vld1q_u32( (const uint32_t *)(P) )
+#define vec32_store(P,V)	vst1q_u32( (uint32_t *)(P), (V) )
+#define vec32_dup(N)		vdupq_n_u32( (UINT32)(N) )
+#define vec32_set(A,B,C,D)	vsetq_lane_u32( (D), vsetq_lane_u32( (C), vsetq_lane_u32( (B), vdupq_n_u32(A), 1 ), 2 ), 3 )
+#define vec32_add(A,B)		vaddq_u32( (A), (B) )
+#define vec32_sub(A,B)		vsubq_u32( (A), (B) )
+#define vec32_or(A,B)		vorrq_u32( (A), (B) )
+#define vec32_mul(A,B)		vmulq_u32( (A), (B) )
+#define vec32_srl(V,N)		vshrq_n_u32( (V), (N) )
+#define vec32_sra(V,N)		vreinterpretq_u32_s32( vshrq_n_s32( vreinterpretq_s32_u32(V), (N) ) )
+#define vec32_ltu(A,B)		vcltq_u32( (A), (B) )
+
+INLINE int vec32_any( vec32 m )
+{
+	uint32x2_t h = vorr_u32( vget_low_u32(m), vget_high_u32(m) );
+	return (vget_lane_u32(h,0) | vget_lane_u32(h,1)) != 0;
+}
+
+#else
+
+typedef __m128i vec32;
+
+#define vec32_load(P)		_mm_loadu_si128( (const __m128i *)(P) )
+#define vec32_store(P,V)	_mm_storeu_si128( (__m128i *)(P), (V) )
+#define vec32_dup(N)		_mm_set1_epi32( (int)(N) )
+#define vec32_set(A,B,C,D)	_mm_setr_epi32( (A), (B), (C), (D) )
+#define vec32_add(A,B)		_mm_add_epi32( (A), (B) )
+#define vec32_sub(A,B)		_mm_sub_epi32( (A), (B) )
+#define vec32_or(A,B)		_mm_or_si128( (A), (B) )
+#define vec32_srl(V,N)		_mm_srli_epi32( (V), (N) )
+#define vec32_sra(V,N)		_mm_srai_epi32( (V), (N) )
+#define vec32_ltu(A,B)		_mm_cmplt_epi32( _mm_xor_si128( (A), _mm_set1_epi32(0x80000000) ), \
+								_mm_xor_si128( (B), _mm_set1_epi32(0x80000000) ) )
+#define vec32_any(M)		(_mm_movemask_epi8(M) != 0)
+
+/* SSE2 has no 32x32->32 multiply */
+INLINE vec32 vec32_mul( vec32 a, vec32 b )
+{
+	vec32 even = _mm_mul_epu32( a, b );
+	vec32 odd  = _mm_mul_epu32( _mm_srli_epi64( a, 32 ), _mm_srli_epi64( b, 32 ) );
+	return _mm_unpacklo_epi32( _mm_shuffle_epi32( even, _MM_SHUFFLE(0,0,2,0) ),
+		_mm_shuffle_epi32( odd, _MM_SHUFFLE(0,0,2,0) ) );
+}
+
+#endif
+
+/* (INT32)V / PMS_RATE, rounding towards zero like the C division */
+#define vec32_div_pms(V)	vec32_sra( vec32_add( (V), vec32_srl( vec32_sra( (V), 31 ), 32-PMS_BITS ) ), PMS_BITS )
+
+/* samples from now until the first slot of the channel reaches eve and
+   needs eg_next(), given the current envelope counters. evs doesn't change
+   in between, so this is exact and the loop needn't compare every sample */
+static int FM_BLOCK_EG_STEPS( FM_CH *CH , const UINT32 *evc )
+{
+	int s,steps = FM_BLOCK+1;
+
+	for( s=0 ; s<4 ; s++ )
+	{
+		INT32 left = CH->SLOT[s].eve - (INT32)evc[s];
+		INT32 evs  = CH->SLOT[s].evs;
+		if( left <= evs ) return 1;
+		if( evs > 0 && (left+evs-1)/evs < steps ) steps = (left+evs-1)/evs;
+	}
+	return steps;
+}
+
+/* past the attack ENV_CURVE[] is a straight line, see FMInitTable(), and
+   (evc-EG_DST)>>ENV_BITS looks it up without leaving the vector. Slots only
+   go back to attack on a key on, never inside an update */
+#if FM_SEG_SUPPORT
+#define FM_BLOCK_ATTACK(EVC)	1
+#else
+#define FM_BLOCK_ATTACK(EVC)	( (INT32)(EVC)[0] < EG_DST || (INT32)(EVC)[1] < EG_DST || \
+								  (INT32)(EVC)[2] < EG_DST || (INT32)(EVC)[3] < EG_DST )
+#endif
+
+#define SLOT_VEC(F)	( lane[0] = CH->SLOT[0].F, lane[1] = CH->SLOT[1].F, \
+					  lane[2] = CH->SLOT[2].F, lane[3] = CH->SLOT[3].F, vec32_load(lane) )
+
+/* phase and envelope of the four slots over the block, returns nonzero if
+   any of them gets under EG_CUT_OFF */
+static int FM_BLOCK_PGEG( FM_CH *CH , int length )
+{
+	UINT32 lane[4];
+	vec32 incr = SLOT_VEC(Incr);
+	vec32 evs  = SLOT_VEC(evs);
+	vec32 tll  = SLOT_VEC(TLL);
+	vec32 ams  = SLOT_VEC(ams);
+	vec32 cnt  = SLOT_VEC(Cnt);
+	vec32 evc  = SLOT_VEC(evc);	/* last, lane[] is used below */
+	vec32 cut  = vec32_dup(EG_CUT_OFF);
+	vec32 audible = vec32_dup(0);
+	int useams = (CH->SLOT[0].ams | CH->SLOT[1].ams | CH->SLOT[2].ams | CH->SLOT[3].ams) != 0;
+	int attack = FM_BLOCK_ATTACK( lane );
+	int next = FM_BLOCK_EG_STEPS( CH , lane ) - 1;
+	int s,t;
+
+	for( t=0 ; t<length ; t++ )
+	{
+		vec32 eg;
+
+		/* Phase Generator */
+		if( blk_pms[t] )
+			cnt = vec32_add( cnt, vec32_add( incr,
+				vec32_div_pms( vec32_mul( vec32_dup(blk_pms[t]), incr ) ) ) );
+		else
+			cnt = vec32_add( cnt, incr );
+		vec32_store( blk_pg[t], cnt );
+
+		/* Envelope Generator, eg_next() takes care of the phase changes */
+		evc = vec32_add( evc, evs );
+		if( t == next )
+		{
+			vec32_store( lane, evc );
+			for( s=0 ; s<4 ; s++ )
+			{
+				FM_SLOT *SLOT = &CH->SLOT[s];
+				if( (INT32)lane[s] >= SLOT->eve )
+				{
+					SLOT->evc = lane[s];
+					SLOT->eg_next(SLOT);
+					lane[s] = SLOT->evc;
+				}
+			}
+			evc = vec32_load( lane );
+			attack = FM_BLOCK_ATTACK( lane );
+			next = t + FM_BLOCK_EG_STEPS( CH , lane );
+			evs = SLOT_VEC(evs);
+		}
+		if( attack )
+		{
+			vec32_store( lane, vec32_sra( evc, ENV_BITS ) );
+			eg = vec32_set( ENV_CURVE[lane[0]], ENV_CURVE[lane[1]],
+				ENV_CURVE[lane[2]], ENV_CURVE[lane[3]] );
+		}
+		else
+			eg = vec32_srl( vec32_sub( evc, vec32_dup(EG_DST) ), ENV_BITS );
+		eg = vec32_add( tll, eg );
+		if( useams )
+			eg = vec32_add( eg, vec32_srl( vec32_mul( ams, vec32_dup(blk_amd[t]) ), LFO_BITS ) );
+		vec32_store( blk_eg[t], eg );
+		audible = vec32_or( audible, vec32_ltu( eg, cut ) );
+	}
+
+	vec32_store( lane, cnt );
+	for( s=0 ; s<4 ; s++ ) CH->SLOT[s].Cnt = lane[s];
+	vec32_store( lane, evc );
+	for( s=0 ; s<4 ; s++ ) CH->SLOT[s].evc = lane[s];
+	return vec32_any( audible );
+}
+
+#undef SLOT_VEC
+
+/* where a connect pointer goes: pg_in2..4 or the carrier */
+INLINE int FM_BLOCK_PORT( INT32 *connect )
+{
+	if( connect == &pg_in2 ) return 0;
+	if( connect == &pg_in3 ) return 1;
+	if( connect == &pg_in4 ) return 2;
+	return connect ? 3 : -1;
+}
+
+/* the connection part of FM_CALC_CH() over the block */
+static void FM_BLOCK_CONNECT( FM_CH *CH , INT32 *out , int length )
+{
+	INT32 in[4];	/* pg_in2 , pg_in3 , pg_in4 and the carrier */
+	INT32 op0 = CH->op1_out[0], op1 = CH->op1_out[1];
+	int c1 = FM_BLOCK_PORT( CH->connect1 );
+	int c2 = FM_BLOCK_PORT( CH->connect2 );
+	int c3 = FM_BLOCK_PORT( CH->connect3 );
+	int fb = CH->FB;
+	int t;
+
+	for( t=0 ; t<length ; t++ )
+	{
+		const UINT32 *pg = blk_pg[t];
+		const UINT32 *eg = blk_eg[t];
+
+		in[0] = pg[SLOT2];
+		in[1] = pg[SLOT3];
+		in[2] = pg[SLOT4];
+		in[3] = 0;
+		if( eg[SLOT1] < EG_CUT_OFF )
+		{
+			INT32 pg1 = pg[SLOT1];
+			if( fb ){
+				pg1 += (op0+op1)>>fb;
+				op1 = op0;
+			}
+			op0 = OP_OUT(pg1,eg[SLOT1]);
+			if( c1 < 0 )
+			{
+				/* algorythm 5 */
+				in[0] += op0;
+				in[1] += op0;
+				in[2] += op0;
+			}else in[c1] += op0;
+		}
+		if( eg[SLOT2] < EG_CUT_OFF )
+			in[c2] += OP_OUT(in[0],eg[SLOT2]);
+		if( eg[SLOT3] < EG_CUT_OFF )
+			in[c3] += OP_OUT(in[1],eg[SLOT3]);
+		if( eg[SLOT4] < EG_CUT_OFF )
+			in[3] += OP_OUT(in[2],eg[SLOT4]);
+		out[t] += in[3];
+	}
+	CH->op1_out[0] = op0;
+	CH->op1_out[1] = op1;
+}
+
+/* LFO for the block, as the update loops would step it */
+static void FM_BLOCK_LFO( int lfo , int length )
+{
+	int t;
+
+	for( t=0 ; t<length ; t++ )
+	{
+#if FM_LFO_SUPPORT
+#if (BUILD_LFO)
+		if( lfo && LFOIncr )
+		{
+			lfo_amd = OPN_LFO_wave[(LFOCnt+=LFOIncr)>>LFO_SHIFT];
+			lfo_pmd = lfo_amd-(LFO_RATE/2);
+		}
+#endif
+		blk_amd[t] = lfo_amd;
+		blk_pmd[t] = lfo_pmd;
+#else
+		blk_amd[t] = 0;
+		blk_pmd[t] = 0;
+#endif
+	}
+}
+
+static void OPN_CALC_BLOCK_RUN( FM_CH **chs , int chans , int length , int lfo )
+{
+	int c,t;
+
+	FM_BLOCK_LFO( lfo , length );
+	memset( blk_out, 0, sizeof(blk_out) );
+	for( c=0 ; c<chans ; c++ )
+	{
+		FM_CH *CH = chs[c];
+
+		for( t=0 ; t<length ; t++ )
+			blk_pms[t] = blk_pmd[t] * CH->pms / LFO_RATE;
+		if( FM_BLOCK_PGEG( CH , length ) )
+			FM_BLOCK_CONNECT( CH , blk_out[CH->connect4-out_ch] , length );
+	}
+}
+
+/* -fmcheck: run the block with FM_CALC_CH() too, from the same state */
+static void OPN_CALC_BLOCK_CHECK( FM_CH **chs , int chans , int length , int lfo )
+{
+	FM_CH before[8],after[8];
+	UINT32 amd = 0, amd_after = 0;
+	INT32 pmd = 0, pmd_after = 0;
+	UINT32 cnt = 0, cnt_after = 0;
+	UINT32 start;
+	int c,t,bad = 0;
+
+	for( c=0 ; c<chans ; c++ ) memcpy( &before[c], chs[c], sizeof(FM_CH) );
+#if FM_LFO_SUPPORT
+	amd = lfo_amd;
+	pmd = lfo_pmd;
+#if (BUILD_LFO)
+	cnt = LFOCnt;
+#endif
+#endif
+
+	start = osd_cycles();
+	OPN_CALC_BLOCK_RUN( chs , chans , length , lfo );
+	fm_check_time[1] += osd_cycles() - start;
+
+	for( c=0 ; c<chans ; c++ )
+	{
+		memcpy( &after[c], chs[c], sizeof(FM_CH) );
+		memcpy( chs[c], &before[c], sizeof(FM_CH) );
+	}
+#if FM_LFO_SUPPORT
+	amd_after = lfo_amd;
+	pmd_after = lfo_pmd;
+	lfo_amd = amd;
+	lfo_pmd = pmd;
+#if (BUILD_LFO)
+	cnt_after = LFOCnt;
+	LFOCnt = cnt;
+#endif
+#endif
+
+	start = osd_cycles();
+	for( t=0 ; t<length ; t++ )
+	{
+#if FM_LFO_SUPPORT
+#if (BUILD_LFO)
+		if( lfo && LFOIncr )
+		{
+			lfo_amd = OPN_LFO_wave[(LFOCnt+=LFOIncr)>>LFO_SHIFT];
+			lfo_pmd = lfo_amd-(LFO_RATE/2);
+		}
+#endif
+#endif
+		out_ch[0] = out_ch[OUTD_LEFT] = out_ch[OUTD_RIGHT] = out_ch[OUTD_CENTER] = 0;
+		for( c=0 ; c<chans ; c++ )
+			FM_CALC_CH( chs[c] );
+		for( c=0 ; c<4 ; c++ )
+		{
+			if( out_ch[c] != blk_out[c][t] ) bad = 1;
+			blk_out[c][t] = out_ch[c];
+		}
+	}
+	fm_check_time[0] += osd_cycles() - start;
+
+	for( c=0 ; c<chans ; c++ )
+		if( memcmp( &after[c], chs[c], sizeof(FM_CH) ) ) bad = 1;
+#if FM_LFO_SUPPORT
+	if( amd_after != lfo_amd || pmd_after != lfo_pmd ) bad = 1;
+#if (BUILD_LFO)
+	if( cnt_after != LFOCnt ) bad = 1;
+#endif
+#endif
+
+	/* go on from the FM_CALC_CH() state and output either way, so one
+	   mismatch doesn't turn into all the later ones */
+	fm_check_blocks++;
+	if( bad && fm_check_bad++ < 16 )
+		logerror("fmcheck: block %d of %d samples differs\n",fm_check_blocks,length);
+}
+
+/* FM output for up to FM_BLOCK samples of the channels in chs[], left in
+   blk_out[] for FM_BLOCK_OUT(). lfo is zero for the YM2203, which has none */
+static void OPN_CALC_BLOCK( FM_CH **chs , int chans , int length , int lfo )
+{
+	if( length > FM_BLOCK ) length = FM_BLOCK;
+	if( fm_check )
+		OPN_CALC_BLOCK_CHECK( chs , chans , length , lfo );
+	else
+		OPN_CALC_BLOCK_RUN( chs , chans , length , lfo );
+}
+
+/* FM output of sample i of the block */
+#define FM_BLOCK_OUT(i)								\
+{													\
+	out_ch[OUTD_LEFT]   = blk_out[OUTD_LEFT][i];	\
+	out_ch[OUTD_RIGHT]  = blk_out[OUTD_RIGHT][i];	\
+	out_ch[OUTD_CENTER] = blk_out[OUTD_CENTER][i];	\
+}
+
+#else /* FM_SIMD */
+
+#define FM_BLOCK_ON 0
+#define OPN_CALC_BLOCK(chs,chans,length,lfo)
+#define FM_BLOCK_OUT(i)
+
+#endif /* FM_SIMD */
 #endif /* BUILD_OPN */
 
 #if BUILD_OPN_PRESCALER
@@ -1485,10 +1895,20 @@ void YM2203UpdateOne(int num, INT16 *buffer, int length)
     for( i=0; i < length ; i++ )
 	{
 		/*            channel A         channel B         channel C      */
-		out_ch[OUTD_CENTER] = 0;
-		/* calcrate FM */
-		for( ch=cch[0] ; ch <= cch[2] ; ch++)
-			FM_CALC_CH( ch );
+		if( FM_BLOCK_ON )
+		{
+			/* calcrate FM a block ahead */
+			if( (i & (FM_BLOCK-1)) == 0 )
+				OPN_CALC_BLOCK( cch, 3, length-i, 0 );
+			FM_BLOCK_OUT( i & (FM_BLOCK-1) );
+		}
+		else
+		{
+			out_ch[OUTD_CENTER] = 0;
+			/* calcrate FM */
+			for( ch=cch[0] ; ch <= cch[2] ; ch++)
+				FM_CALC_CH( ch );
+		}
 		/* limit check */
 		Limit( out_ch[OUTD_CENTER] , FM_MAXOUT, FM_MINOUT );
 		/* store to sound buffer */
@@ -2064,22 +2484,33 @@ void YM2608UpdateOne(int num, INT16 **buffer, int length)
 	/* buffering */
     for( i=0; i < length ; i++ )
 	{
-#if FM_LFO_SUPPORT
-		/* LFO */
-		if( LFOIncr )
+		if( FM_BLOCK_ON )
 		{
-			lfo_amd = OPN_LFO_wave[(LFOCnt+=LFOIncr)>>LFO_SHIFT];
-			lfo_pmd = lfo_amd-(LFO_RATE/2);
+			/* FM a block ahead */
+			if( (i & (FM_BLOCK-1)) == 0 )
+				OPN_CALC_BLOCK( cch, 6, length-i, 1 );
+			FM_BLOCK_OUT( i & (FM_BLOCK-1) );
 		}
+		else
+		{
+#if FM_LFO_SUPPORT
+			/* LFO */
+			if( LFOIncr )
+			{
+				lfo_amd = OPN_LFO_wave[(LFOCnt+=LFOIncr)>>LFO_SHIFT];
+				lfo_pmd = lfo_amd-(LFO_RATE/2);
+			}
 #endif
-		/* clear output acc. */
-		out_ch[OUTD_LEFT] = out_ch[OUTD_RIGHT]= out_ch[OUTD_CENTER] = 0;
+			/* clear output acc. */
+			out_ch[OUTD_LEFT] = out_ch[OUTD_RIGHT]= out_ch[OUTD_CENTER] = 0;
+		}
 		/**** deltaT ADPCM ****/
 		if( DELTAT->flag )
 			YM_DELTAT_ADPCM_CALC(DELTAT);
 		/* FM */
-		for(ch = cch[0] ; ch <= cch[5] ; ch++)
-			FM_CALC_CH( ch );
+		if( !FM_BLOCK_ON )
+			for(ch = cch[0] ; ch <= cch[5] ; ch++)
+				FM_CALC_CH( ch );
 		for( j = 0; j < 6; j++ )
 		{
 			/**** ADPCM ****/
@@ -2467,22 +2898,33 @@ void YM2610UpdateOne(int num, INT16 **buffer, int length)
 	/* buffering */
     for( i=0; i < length ; i++ )
 	{
-#if FM_LFO_SUPPORT
-		/* LFO */
-		if( LFOIncr )
+		if( FM_BLOCK_ON )
 		{
-			lfo_amd = OPN_LFO_wave[(LFOCnt+=LFOIncr)>>LFO_SHIFT];
-			lfo_pmd = lfo_amd-(LFO_RATE/2);
+			/* FM a block ahead */
+			if( (i & (FM_BLOCK-1)) == 0 )
+				OPN_CALC_BLOCK( cch, 4, length-i, 1 );
+			FM_BLOCK_OUT( i & (FM_BLOCK-1) );
 		}
+		else
+		{
+#if FM_LFO_SUPPORT
+			/* LFO */
+			if( LFOIncr )
+			{
+				lfo_amd = OPN_LFO_wave[(LFOCnt+=LFOIncr)>>LFO_SHIFT];
+				lfo_pmd = lfo_amd-(LFO_RATE/2);
+			}
 #endif
-		/* clear output acc. */
-		out_ch[OUTD_LEFT] = out_ch[OUTD_RIGHT]= out_ch[OUTD_CENTER] = 0;
+			/* clear output acc. */
+			out_ch[OUTD_LEFT] = out_ch[OUTD_RIGHT]= out_ch[OUTD_CENTER] = 0;
+		}
 		/**** deltaT ADPCM ****/
 		if( DELTAT->flag )
 			YM_DELTAT_ADPCM_CALC(DELTAT);
 		/* FM */
-		for(ch = 0 ; ch < 4 ; ch++)
-			FM_CALC_CH( cch[ch] );
+		if( !FM_BLOCK_ON )
+			for(ch = 0 ; ch < 4 ; ch++)
+				FM_CALC_CH( cch[ch] );
 		for( j = 0; j < 6; j++ )
 		{
 			/**** ADPCM ****/
@@ -2557,22 +2999,33 @@ void YM2610BUpdateOne(int num, INT16 **buffer, int length)
 	/* buffering */
     for( i=0; i < length ; i++ )
 	{
-#if FM_LFO_SUPPORT
-		/* LFO */
-		if( LFOIncr )
+		if( FM_BLOCK_ON )
 		{
-			lfo_amd = OPN_LFO_wave[(LFOCnt+=LFOIncr)>>LFO_SHIFT];
-			lfo_pmd = lfo_amd-(LFO_RATE/2);
+			/* FM a block ahead */
+			if( (i & (FM_BLOCK-1)) == 0 )
+				OPN_CALC_BLOCK( cch, 6, length-i, 1 );
+			FM_BLOCK_OUT( i & (FM_BLOCK-1) );
 		}
+		else
+		{
+#if FM_LFO_SUPPORT
+			/* LFO */
+			if( LFOIncr )
+			{
+				lfo_amd = OPN_LFO_wave[(LFOCnt+=LFOIncr)>>LFO_SHIFT];
+				lfo_pmd = lfo_amd-(LFO_RATE/2);
+			}
 #endif
-		/* clear output acc. */
-		out_ch[OUTD_LEFT] = out_ch[OUTD_RIGHT]= out_ch[OUTD_CENTER] = 0;
+			/* clear output acc. */
+			out_ch[OUTD_LEFT] = out_ch[OUTD_RIGHT]= out_ch[OUTD_CENTER] = 0;
+		}
 		/**** deltaT ADPCM ****/
 		if( DELTAT->flag )
 			YM_DELTAT_ADPCM_CALC(DELTAT);
 		/* FM */
-		for(ch = cch[0] ; ch <= cch[5] ; ch++)
-			FM_CALC_CH( ch );
+		if( !FM_BLOCK_ON )
+			for(ch = cch[0] ; ch <= cch[5] ; ch++)
+				FM_CALC_CH( ch );
 		for( j = 0; j < 6; j++ )
 		{
 			/**** ADPCM ****/
@@ -2920,19 +3373,30 @@ void YM2612UpdateOne(int num, INT16 **buffer, int length)
 	/* buffering */
     for( i=0; i < length ; i++ )
 	{
-#if FM_LFO_SUPPORT
-		/* LFO */
-		if( LFOIncr )
+		if( FM_BLOCK_ON )
 		{
-			lfo_amd = OPN_LFO_wave[(LFOCnt+=LFOIncr)>>LFO_SHIFT];
-			lfo_pmd = lfo_amd-(LFO_RATE/2);
+			/* FM a block ahead */
+			if( (i & (FM_BLOCK-1)) == 0 )
+				OPN_CALC_BLOCK( cch, dacen ? 5 : 6, length-i, 1 );
+			FM_BLOCK_OUT( i & (FM_BLOCK-1) );
 		}
+		else
+		{
+#if FM_LFO_SUPPORT
+			/* LFO */
+			if( LFOIncr )
+			{
+				lfo_amd = OPN_LFO_wave[(LFOCnt+=LFOIncr)>>LFO_SHIFT];
+				lfo_pmd = lfo_amd-(LFO_RATE/2);
+			}
 #endif
-		/* clear output acc. */
-		out_ch[OUTD_LEFT] = out_ch[OUTD_RIGHT]= out_ch[OUTD_CENTER] = 0;
+			/* clear output acc. */
+			out_ch[OUTD_LEFT] = out_ch[OUTD_RIGHT]= out_ch[OUTD_CENTER] = 0;
+		}
 		/* calcrate channel output */
-		for(ch = cch[0] ; ch <= ech ; ch++)
-			FM_CALC_CH( ch );
+		if( !FM_BLOCK_ON )
+			for(ch = cch[0] ; ch <= ech ; ch++)
+				FM_CALC_CH( ch );
 		if( dacen )  *cch[5]->connect4 += dacout;
 		/* buffering */
 		FM_BUFFERING_STEREO;
@@ -3132,6 +3596,204 @@ int YM2612TimerOver(int n,int c)
 
 #endif /* BUILD_YM2612 */
 
+/*******************************************************************************/
+/*		OPN engine self test (-fmselftest)                                     */
+/*******************************************************************************/
+/* Drives every OPN chip built in with the same random register traffic three
+   times: FM_CALC_CH() only, the block engine, and -fmcheck. The output of the
+   three runs must hash the same and -fmcheck must find no differing block.
+   Runs before a game is started, so no stream or SSG is touched. */
+
+static UINT32 selftest_seed,selftest_hash;
+static INT16 selftest_buf[2][1024];
+
+static UINT32 selftest_rand(void)
+{
+	selftest_seed = selftest_seed*1103515245+12345;
+	return selftest_seed>>8;
+}
+
+typedef int (*selftest_write)(int n,int a,unsigned char v);
+typedef void (*selftest_update)(int num,INT16 **buffer,int length);
+
+#if BUILD_YM2203
+static void selftest_update2203(int num,INT16 **buffer,int length)
+{
+	YM2203UpdateOne(num,buffer[0],length);
+	memset(buffer[1],0,length*sizeof(INT16));
+}
+#endif
+
+/* random key on, LFO, CSM, frequency and operator writes between updates */
+static UINT32 selftest_script(selftest_write wr,selftest_update upd,int ports,int frames)
+{
+	INT16 *buf[2] = { selftest_buf[0], selftest_buf[1] };
+	UINT32 start,elapsed = 0;
+	int f,k,i,n,len,port,r,v;
+
+	for( f = 0 ; f < frames ; f++ )
+	{
+		n = selftest_rand() % 24;
+		for( k = 0 ; k < n ; k++ )
+		{
+			port = ports > 1 ? selftest_rand() & 1 : 0;
+			v = selftest_rand() & 0xff;
+			switch( selftest_rand() % 10 )
+			{
+			case 0:	/* key on/off */
+				r = 0x28; port = 0;
+				v = (selftest_rand() & 0xf0) | (selftest_rand() % 3) | (ports > 1 ? (selftest_rand() & 4) : 0);
+				break;
+			case 1:	/* LFO */
+				r = 0x22; port = 0;
+				v = (selftest_rand() & 1) ? 8 | (selftest_rand() & 7) : 0;
+				break;
+			case 2:	/* CSM / 3 slot mode */
+				r = 0x27; port = 0;
+				v = (selftest_rand() & 3) == 0 ? ((selftest_rand() & 1) ? 0x40 : 0x80) : 0;
+				break;
+			case 3:	/* fnum , block */
+				r = 0xa4 + selftest_rand() % 3;
+				wr(0,port*2,r); wr(0,port*2+1,selftest_rand() & 0x3f);
+				r -= 4;
+				break;
+			case 4:	/* 3 slot mode fnum , block */
+				r = 0xac + selftest_rand() % 3; port = 0;
+				wr(0,0,r); wr(0,1,selftest_rand() & 0x3f);
+				r -= 4;
+				break;
+			case 5: r = 0xb0 + selftest_rand() % 3; break;
+			case 6: r = 0xb4 + selftest_rand() % 3; break;
+			case 7:	/* total level , mostly audible */
+				r = 0x40 + selftest_rand() % 16;
+				v &= (selftest_rand() & 1) ? 0x1f : 0x7f;
+				break;
+			default: r = 0x30 + selftest_rand() % 0x70; break;
+			}
+			wr(0,port*2,r);
+			wr(0,port*2+1,v);
+		}
+		len = (selftest_rand() & 3) ? 735 : 1 + selftest_rand() % 1000;
+		start = osd_cycles();
+		upd(0,buf,len);
+		elapsed += osd_cycles() - start;
+		for( i = 0 ; i < len ; i++ )
+			selftest_hash = ((selftest_hash*31) ^ (UINT16)buf[0][i]) * 31 ^ (UINT16)buf[1][i];
+	}
+	return elapsed;
+}
+
+/* run one chip: 0 = FM_CALC_CH() , 1 = block engine , 2 = -fmcheck */
+/* returns 0 when the chip is not built in */
+static int selftest_run(int chip,int mode,int frames,UINT32 *hash,UINT32 *elapsed,int *bad)
+{
+	static UINT8 pcm[0x100];
+	static short rhythm[0x100];
+	void *rom[1] = { pcm };
+	int size[1] = { sizeof(pcm) };
+	int pos[7] = { 0 };
+
+	fm_block = mode != 0;
+	fm_check = mode == 2;
+	selftest_seed = chip+1;
+	selftest_hash = 0;
+	*elapsed = 0;
+	switch( chip )
+	{
+#if BUILD_YM2203
+	case 0:
+		YM2203Init(1,4000000,44100,0,0);
+		*elapsed = selftest_script(YM2203Write,selftest_update2203,1,frames);
+		break;
+#endif
+#if BUILD_YM2608
+	case 1:
+		YM2608Init(1,8000000,44100,rom,size,rhythm,pos,0,0);
+		*elapsed = selftest_script(YM2608Write,YM2608UpdateOne,2,frames);
+		break;
+#endif
+#if BUILD_YM2610
+	case 2:
+		YM2610Init(1,8000000,44100,rom,size,rom,size,0,0);
+		*elapsed = selftest_script(YM2610Write,YM2610UpdateOne,2,frames);
+		break;
+#endif
+#if BUILD_YM2610B
+	case 3:
+		YM2610Init(1,8000000,44100,rom,size,rom,size,0,0);
+		*elapsed = selftest_script(YM2610Write,YM2610BUpdateOne,2,frames);
+		break;
+#endif
+#if BUILD_YM2612
+	case 4:
+		YM2612Init(1,7670000,44100,0,0);
+		*elapsed = selftest_script(YM2612Write,YM2612UpdateOne,2,frames);
+		break;
+#endif
+	default:
+		return 0;
+	}
+	*hash = selftest_hash;
+	/* FMCloseTable() clears the counters */
+	*bad = fm_check_bad;
+	switch( chip )
+	{
+#if BUILD_YM2203
+	case 0: YM2203Shutdown(); break;
+#endif
+#if BUILD_YM2608
+	case 1: YM2608Shutdown(); break;
+#endif
+#if BUILD_OPNB
+	case 2: case 3: YM2610Shutdown(); break;
+#endif
+#if BUILD_YM2612
+	case 4: YM2612Shutdown(); break;
+#endif
+	}
+	return 1;
+}
+
+/* returns the number of chips whose engines disagree */
+int FMSelfTest(int frames)
+{
+	static const char *name[5] = { "YM2203", "YM2608", "YM2610", "YM2610B", "YM2612" };
+	int save_block = fm_block, save_check = fm_check;
+	int chip,bad,failed = 0;
+
+#ifdef FM_SIMD
+	if( !osd_cpu_has_simd() )
+	{
+		printf("fmselftest: block engine disabled by -nosimd\n");
+		return 0;
+	}
+	printf("fmselftest: %s block engine, %d frames per chip\n",FM_SIMD,frames);
+#else
+	printf("fmselftest: no block engine in this build\n");
+	return 0;
+#endif
+
+	for( chip = 0 ; chip < 5 ; chip++ )
+	{
+		UINT32 hash[3],elapsed[3];
+		int ok;
+
+		if( !selftest_run(chip,0,frames,&hash[0],&elapsed[0],&bad) )
+			continue;
+		selftest_run(chip,1,frames,&hash[1],&elapsed[1],&bad);
+		selftest_run(chip,2,frames,&hash[2],&elapsed[2],&bad);
+		ok = hash[0] == hash[1] && hash[0] == hash[2] && bad == 0;
+		if( !ok )
+			failed++;
+		printf("fmselftest: %-7s  sample %7u us  block %7u us  %08x %08x %08x  fmcheck %d bad  %s\n",
+			name[chip],elapsed[0],elapsed[1],hash[0],hash[1],hash[2],bad,ok ? "same" : "DIFFERENT");
+	}
+
+	fm_block = save_block;
+	fm_check = save_check;
+	return failed;
+}
+
 
 #if BUILD_YM2151
 /*******************************************************************************/
@@ -212,6 +212,9 @@ int YM2612TimerOver(int n, int c );
 
 #endif /* BUILD_YM2612 */
 
+/* -fmselftest: returns the number of OPN chips whose engines disagree */
+int FMSelfTest(int frames);
+
 #if BUILD_YM2151
 /* -------------------- YM2151(OPM) Interface -------------------- */
 int OPMInit(int num, int baseclock, int rate,
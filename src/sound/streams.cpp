@@ -23,6 +23,9 @@ static int stream_sample_length[MIXER_MAX_CHANNELS];	/* in usec */
 static int stream_param[MIXER_MAX_CHANNELS];
 static void (*stream_callback[MIXER_MAX_CHANNELS])(int param,INT16 *buffer,int length);
 static void (*stream_callback_multi[MIXER_MAX_CHANNELS])(int param,INT16 **buffer,int length);
+static const void *stream_group[MIXER_MAX_CHANNELS];
+
+int streams_parallel = 0;	/* -parallelsound */
 
 static int memory[MIXER_MAX_CHANNELS];
 static int r1[MIXER_MAX_CHANNELS];
@@ -110,61 +113,119 @@ void streams_sh_stop(void)
 }
 
 
-void streams_sh_update(void)
+/* render what is left of this frame for a stream and its joined channels */
+static void stream_render_frame(int channel)
 {
-	int channel,i;
+	int newpos;
+	int buflen;
+	int i;
 
 
-	if (Machine->sample_rate == 0) return;
+	newpos = SAMPLES_THIS_FRAME(channel);
 
-	/* update all the output buffers */
-	for (channel = 0;channel < MIXER_MAX_CHANNELS;channel += stream_joined_channels[channel])
+	buflen = newpos - stream_buffer_pos[channel];
+
+	if (stream_joined_channels[channel] > 1)
 	{
-		if (stream_buffer[channel])
+		INT16 *buf[MIXER_MAX_CHANNELS];
+
+
+		if (buflen > 0)
 		{
-			int newpos;
-			int buflen;
+			for (i = 0;i < stream_joined_channels[channel];i++)
+				buf[i] = stream_buffer[channel+i] + stream_buffer_pos[channel+i];
 
+			(*stream_callback_multi[channel])(stream_param[channel],buf,buflen);
+		}
 
-			newpos = SAMPLES_THIS_FRAME(channel);
+		for (i = 0;i < stream_joined_channels[channel];i++)
+			stream_buffer_pos[channel+i] = 0;
 
-			buflen = newpos - stream_buffer_pos[channel];
+		for (i = 0;i < stream_joined_channels[channel];i++)
+			apply_RC_filter(channel+i,stream_buffer[channel+i],buflen,stream_sample_rate[channel+i]);
+	}
+	else
+	{
+		if (buflen > 0)
+		{
+			INT16 *buf;
 
-			if (stream_joined_channels[channel] > 1)
-			{
-				INT16 *buf[MIXER_MAX_CHANNELS];
 
+			buf = stream_buffer[channel] + stream_buffer_pos[channel];
 
-				if (buflen > 0)
-				{
-					for (i = 0;i < stream_joined_channels[channel];i++)
-						buf[i] = stream_buffer[channel+i] + stream_buffer_pos[channel+i];
+			(*stream_callback[channel])(stream_param[channel],buf,buflen);
+		}
 
-					(*stream_callback_multi[channel])(stream_param[channel],buf,buflen);
-				}
+		stream_buffer_pos[channel] = 0;
 
-				for (i = 0;i < stream_joined_channels[channel];i++)
-					stream_buffer_pos[channel+i] = 0;
+		apply_RC_filter(channel,stream_buffer[channel],buflen,stream_sample_rate[channel]);
+	}
+}
 
-				for (i = 0;i < stream_joined_channels[channel];i++)
-					apply_RC_filter(channel+i,stream_buffer[channel+i],buflen,stream_sample_rate[channel+i]);
-			}
-			else
-			{
-				if (buflen > 0)
-				{
-					INT16 *buf;
 
+/*
+  With -parallelsound the streams are split into groups, one per
+  stream_group key, and the groups are rendered on the worker threads.
+  Streams in a group run in channel order on one thread, so chips that
+  share their core's static state never run at the same time. The mixer
+  is only fed once all groups are done.
+*/
+static int stream_task_first[MIXER_MAX_CHANNELS];
+static int stream_task_next[MIXER_MAX_CHANNELS];
 
-					buf = stream_buffer[channel] + stream_buffer_pos[channel];
+static void stream_render_tasks(void *param,int start,int end)
+{
+	int task,channel;
 
-					(*stream_callback[channel])(stream_param[channel],buf,buflen);
-				}
 
-				stream_buffer_pos[channel] = 0;
+	for (task = start;task < end;task++)
+		for (channel = stream_task_first[task];channel >= 0;channel = stream_task_next[channel])
+			stream_render_frame(channel);
+}
+
+static int stream_build_tasks(void)
+{
+	int last[MIXER_MAX_CHANNELS];
+	int channel,task,tasks = 0;
+
+
+	for (channel = 0;channel < MIXER_MAX_CHANNELS;channel += stream_joined_channels[channel])
+	{
+		if (stream_buffer[channel] == 0) continue;
+
+		stream_task_next[channel] = -1;
+		for (task = 0;task < tasks;task++)
+			if (stream_group[stream_task_first[task]] == stream_group[channel])
+				break;
+		if (task == tasks)
+		{
+			stream_task_first[tasks++] = channel;
+		}
+		else
+			stream_task_next[last[task]] = channel;
+		last[task] = channel;
+	}
+
+	return tasks;
+}
+
 
-				apply_RC_filter(channel,stream_buffer[channel],buflen,stream_sample_rate[channel]);
-			}
+void streams_sh_update(void)
+{
+	int channel,i;
+
+
+	if (Machine->sample_rate == 0) return;
+
+	/* update all the output buffers */
+	if (streams_parallel && osd_parallel_workers() > 1)
+		osd_parallel_for(stream_build_tasks(),stream_render_tasks,0);
+	else
+	{
+		for (channel = 0;channel < MIXER_MAX_CHANNELS;channel += stream_joined_channels[channel])
+		{
+			if (stream_buffer[channel])
+				stream_render_frame(channel);
 		}
 	}
 
@@ -207,6 +268,7 @@ int stream_init(const char *name,int default_mixing_level,
 		stream_sample_length[channel] = 0;
 	stream_param[channel] = param;
 	stream_callback[channel] = callback;
+	stream_group[channel] = (const void *)callback;
 	set_RC_filter(channel,0,0,0,0);
 
 	return channel;
@@ -243,12 +305,19 @@ int stream_init_multi(int channels,const char **names,const int *default_mixing_
 
 	stream_param[channel] = param;
 	stream_callback_multi[channel] = callback;
+	stream_group[channel] = (const void *)callback;
 	set_RC_filter(channel,0,0,0,0);
 
 	return channel;
 }
 
 
+void stream_set_group(int channel,const void *key)
+{
+	stream_group[channel] = key;
+}
+
+
 /* min_interval is in usec */
 void stream_update(int channel,int min_interval)
 {
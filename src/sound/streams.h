@@ -15,4 +15,10 @@ int stream_init_multi(int channels,const char **names,const int *default_mixing_
 		int param,void (*callback)(int param,INT16 **buffer,int length));
 void stream_update(int channel,int min_interval);	/* min_interval is in usec */
 
+/* Streams with the same group key are never rendered concurrently by
+   -parallelsound. The default key is the stream's callback; cores whose
+   different callbacks share static state set a common key. */
+void stream_set_group(int channel,const void *key);
+#define STREAM_GROUP_YAMAHA_FM	((const void *)1)	/* fm.c, fmopl.c, ymdeltat.c */
+
 #endif
@@ -1,7 +1,6 @@
 /* tilemap.c
 
 In Progress
--	visibility walk (temporarily broken)
 -	nowrap
 
 To Do:
@@ -32,14 +31,19 @@ To Do:
 	5)	call tilemap_draw to draw the tilemaps to the screen, from back to front
 */
 
-#define USE_VISIBLE 0
 #define NOT_USE_CACHED_INDEX_TO_MEMORY_OFFSET 0
 
 #include "driver.h"
 #include "tilemap.h"
+#include "osinline.h"
 
 #define SWAP(X,Y) {UINT32 temp=X; X=Y; Y=temp; }
 
+/* bitsets for the dirty and visible tile flags */
+#define BIT_WORDS(N)	(((N)+31)>>5)
+#define BIT_SET(B,I)	((B)[(I)>>5] |= 1<<((I)&31))
+#define BIT_TEST(B,I)	(((B)[(I)>>5]>>((I)&31))&1)
+
 /***********************************************************************************/
 /* some common mappings */
 
@@ -79,16 +83,16 @@ static int mappings_create( struct tilemap *tilemap ){
 	}
 	max_memory_offset++;
 	tilemap->max_memory_offset = max_memory_offset;
-	/* logical to cached (tilemap_mark_dirty) */
-	tilemap->memory_offset_to_cached_index = (int*)malloc( sizeof(int)*max_memory_offset );
-	if( tilemap->memory_offset_to_cached_index ){
+	/* logical to dirty_vram bit (tilemap_mark_dirty) */
+	tilemap->memory_offset_to_dirty_bit = (int*)malloc( sizeof(int)*max_memory_offset );
+	if( tilemap->memory_offset_to_dirty_bit ){
 #if NOT_USE_CACHED_INDEX_TO_MEMORY_OFFSET
 		return 0;   /* no error */
 #else
 		/* cached to logical (get_tile_info) */
 		tilemap->cached_index_to_memory_offset = (UINT32*)malloc( sizeof(UINT32)*tilemap->num_tiles );
 		if( tilemap->cached_index_to_memory_offset ) return 0; /* no error */
-		free( tilemap->memory_offset_to_cached_index );
+		free( tilemap->memory_offset_to_dirty_bit );
 #endif
 	}
 	return -1; /* error */
@@ -99,7 +103,7 @@ static void mappings_dispose( struct tilemap *tilemap ){
 #else
 	free( tilemap->cached_index_to_memory_offset );
 #endif
-	free( tilemap->memory_offset_to_cached_index );
+	free( tilemap->memory_offset_to_dirty_bit );
 }
 
 static void mappings_update( struct tilemap *tilemap ){
@@ -110,7 +114,7 @@ static void mappings_update( struct tilemap *tilemap ){
 	UINT32 num_logical_rows = tilemap->num_logical_rows;
 	UINT32 num_logical_cols = tilemap->num_logical_cols;
 	for( logical_index=0; logical_index<tilemap->max_memory_offset; logical_index++ ){
-		tilemap->memory_offset_to_cached_index[logical_index] = -1;
+		tilemap->memory_offset_to_dirty_bit[logical_index] = -1;
 	}
 
 	/*logerror("log size(%dx%d); cach size(%dx%d)\n",
@@ -127,7 +131,7 @@ static void mappings_update( struct tilemap *tilemap ){
 		if( tilemap->orientation & ORIENTATION_FLIP_X ) cached_col = (num_cached_cols-1)-cached_col;
 		if( tilemap->orientation & ORIENTATION_FLIP_Y ) cached_row = (num_cached_rows-1)-cached_row;
 		cached_index = cached_row*num_cached_cols+cached_col;
-		tilemap->memory_offset_to_cached_index[memory_offset] = cached_index;
+		tilemap->memory_offset_to_dirty_bit[memory_offset] = cached_row*tilemap->dirty_words*32+cached_col;
 #if NOT_USE_CACHED_INDEX_TO_MEMORY_OFFSET
 #else
 		tilemap->cached_index_to_memory_offset[cached_index] = memory_offset;
@@ -170,8 +174,9 @@ enum {
 	TILE_OPAQUE
 };
 
-/* the following parameters are constant across tilemap_draw calls */
-static struct {
+/* the following parameters are constant across tilemap_draw calls; each
+   worker drawing a band has its own copy */
+struct blit_state {
 	int clip_left, clip_top, clip_right, clip_bottom;
 	int source_width, source_height;
 	int dest_line_offset,source_line_offset,mask_line_offset;
@@ -181,11 +186,32 @@ static struct {
 	UINT8 **priority_data_row;
 	int tile_priority;
 	int tilemap_priority_code;
-} blit;
+};
+static __thread struct blit_state blit;
+
+int tilemap_parallel = 0;	/* -paralleltilemap */
+
+#define DRAW_BAND_MIN		16	/* lines; smaller bands cost more to hand out than to draw */
+#define RENDER_PARALLEL_MIN	64	/* dirty tiles before tilemap_render uses the workers */
+
+/* tilemap_draw records its draw() calls, then plays them back band by band */
+struct draw_call {
+	int xpos, ypos;
+	int clip_left, clip_top, clip_right, clip_bottom;
+};
+static struct draw_call *draw_calls;
+static int num_draw_calls, max_draw_calls;
+static void (*draw_func)( int, int );
+static struct blit_state draw_blit;
+static int band_top, band_bottom, band_height;
 
 #define MASKROWBYTES(W) (((W)+7)>>3)
 
-static void memsetbitmask8( UINT8 *dest, int value, const UINT8 *bitmask, int count ){
+/* the innermost loops: palette expansion of a tile into the pixmap, and the
+   masked copy / priority fill driven by the packed bitmask rows. The _c
+   versions are the reference, tilemap_init() swaps in NEON or SSE2 ones */
+
+static void memsetbitmask8_c( UINT8 *dest, int value, const UINT8 *bitmask, int count ){
 /* TBA: combine with memcpybitmask */
 	do{
 		UINT32 data = *bitmask++;
@@ -221,7 +247,7 @@ static void memcpybitmask8( UINT8 *dest, const UINT8 *source, const UINT8 *bitma
 }
 */
 
-static void memcpybitmask8( UINT8 *dest, const UINT32 *source, const UINT8 *bitmask, int count ){
+static void memcpybitmask8_c( UINT8 *dest, const UINT32 *source, const UINT8 *bitmask, int count ){
 	do{
 		UINT32 data = *bitmask++;
 		UINT32 src = *source++;
@@ -260,7 +286,7 @@ static void memcpybitmask16( UINT16 *dest, const UINT16 *source, const UINT8 *bi
 }
 */
 
-static void memcpybitmask16( UINT16 *dest, const UINT32 *source, const UINT8 *bitmask, int count ){
+static void memcpybitmask16_c( UINT16 *dest, const UINT32 *source, const UINT8 *bitmask, int count ){
 	do{
 		UINT32 data = *bitmask++;
 		UINT32 src = *source++;
@@ -282,45 +308,540 @@ static void memcpybitmask16( UINT16 *dest, const UINT32 *source, const UINT8 *bi
 
 /***********************************************************************************/
 
+static void draw_tile8_c( UINT8 **line, int sx, int sy, int dy, int width, int height,
+		const UINT8 *pendata, const UINT16 *paldata, UINT32 pen_usage, int flipx ){
+	int x;
+	if( flipx ){
+		for( ; height; height--, sy+=dy ){
+			UINT8 *dest = sx + line[sy];
+			for( x=width-1; x>=0; x-- ) dest[x] = paldata[*pendata++];
+		}
+	}
+	else {
+		for( ; height; height--, sy+=dy ){
+			UINT8 *dest = sx + line[sy];
+			for( x=0; x<width; x++ ) dest[x] = paldata[*pendata++];
+		}
+	}
+}
+
+static void draw_tile16_c( UINT8 **line, int sx, int sy, int dy, int width, int height,
+		const UINT8 *pendata, const UINT16 *paldata, UINT32 pen_usage, int flipx ){
+	int x;
+	if( flipx ){
+		for( ; height; height--, sy+=dy ){
+			UINT16 *dest = sx + (UINT16 *)line[sy];
+			for( x=width-1; x>=0; x-- ) dest[x] = paldata[*pendata++];
+		}
+	}
+	else {
+		for( ; height; height--, sy+=dy ){
+			UINT16 *dest = sx + (UINT16 *)line[sy];
+			for( x=0; x<width; x++ ) dest[x] = paldata[*pendata++];
+		}
+	}
+}
+
+/***********************************************************************************/
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define TILEMAP_SIMD "NEON"
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define TILEMAP_SIMD "SSE2"
+#endif
+
+
+#ifdef TILEMAP_SIMD
+
+/* vec8 is 16 pixels of 8bpp, vec16 is 8 pixels of 16bpp. Tiles whose pens
+   are all below 16 (pen_usage tells, and that is nearly every tile) get a
+   16 entry table per tile, looked up with vtbl on NEON */
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+
+typedef uint8x16_t vec8;
+typedef uint16x8_t vec16;
+
+static const UINT8 mask_bits8[16] = { 0x80,0x40,0x20,0x10,0x08,0x04,0x02,0x01, 0x80,0x40,0x20,0x10,0x08,0x04,0x02,0x01 };
+static const UINT16 mask_bits16[8] = { 0x80,0x40,0x20,0x10,0x08,0x04,0x02,0x01 };
+
+#define vec8_load(P)		vld1q_u8( (const uint8_t *)(P) )
+#define vec8_store(P,V)		vst1q_u8( (uint8_t *)(P), (V) )
+#define vec8_store_lo(P,V)	vst1_u8( (uint8_t *)(P), vget_low_u8(V) )
+#define vec8_store_hi(P,V)	vst1_u8( (uint8_t *)(P), vget_high_u8(V) )
+#define vec8_select(M,A,B)	vbslq_u8( (M), (A), (B) )
+#define vec8_or_and(D,M,V)	vorrq_u8( (D), vandq_u8( (M), (V) ) )
+#define vec8_dup(N)		vdupq_n_u8( (N) )
+#define vec16_load(P)		vld1q_u16( (const uint16_t *)(P) )
+#define vec16_store(P,V)	vst1q_u16( (uint16_t *)(P), (V) )
+#define vec16_select(M,A,B)	vbslq_u16( (M), (A), (B) )
+
+static inline vec8 mask_expand8( UINT32 m0, UINT32 m1 ){
+	return vtstq_u8( vcombine_u8( vdup_n_u8( m0 ), vdup_n_u8( m1 ) ), vld1q_u8( mask_bits8 ) );
+}
+static inline vec16 mask_expand16( UINT32 m ){
+	return vtstq_u16( vdupq_n_u16( m ), vld1q_u16( mask_bits16 ) );
+}
+
+static inline vec8 vec8_reverse( vec8 v ){
+	v = vrev64q_u8( v );
+	return vcombine_u8( vget_high_u8( v ), vget_low_u8( v ) );
+}
+#define vec8_reverse_halves(V)	vrev64q_u8( (V) )
+static inline vec16 vec16_reverse( vec16 v ){
+	v = vrev64q_u16( v );
+	return vcombine_u16( vget_high_u16( v ), vget_low_u16( v ) );
+}
+
+struct tile_lut {
+	uint8x8x2_t lo, hi;
+};
+
+static inline void lut_tables( struct tile_lut *lut, const UINT16 *paldata, UINT32 pen_usage, int depth ){
+	UINT8 lo[16], hi[16];
+	int pen;
+	for( pen=0; pen<16; pen++ ){
+		/* unused entries may lie past the end of the colortable */
+		UINT32 color = (pen_usage>>pen)&1 ? paldata[pen] : 0;
+		lo[pen] = color;
+		hi[pen] = color>>8;
+	}
+	lut->lo.val[0] = vld1_u8( lo );
+	lut->lo.val[1] = vld1_u8( lo+8 );
+	if( depth==16 ){
+		lut->hi.val[0] = vld1_u8( hi );
+		lut->hi.val[1] = vld1_u8( hi+8 );
+	}
+}
+#define lut_init8(L,P,U)	lut_tables( (L), (P), (U), 8 )
+#define lut_init16(L,P,U)	lut_tables( (L), (P), (U), 16 )
+
+static inline vec8 lut_expand8( const struct tile_lut *lut, const UINT8 *pendata ){
+	uint8x16_t pens = vld1q_u8( pendata );
+	return vcombine_u8( vtbl2_u8( lut->lo, vget_low_u8( pens ) ), vtbl2_u8( lut->lo, vget_high_u8( pens ) ) );
+}
+static inline vec16 lut_expand16( const struct tile_lut *lut, const UINT8 *pendata ){
+	uint8x8_t pens = vld1_u8( pendata );
+	uint8x8x2_t z = vzip_u8( vtbl2_u8( lut->lo, pens ), vtbl2_u8( lut->hi, pens ) );
+	return vreinterpretq_u16_u8( vcombine_u8( z.val[0], z.val[1] ) );
+}
+
+#else
+
+typedef __m128i vec8;
+typedef __m128i vec16;
+
+#define vec8_load(P)		_mm_loadu_si128( (const __m128i *)(P) )
+#define vec8_store(P,V)		_mm_storeu_si128( (__m128i *)(P), (V) )
+#define vec8_store_lo(P,V)	_mm_storel_epi64( (__m128i *)(P), (V) )
+#define vec8_store_hi(P,V)	_mm_storel_epi64( (__m128i *)(P), _mm_unpackhi_epi64( (V), (V) ) )
+#define vec8_select(M,A,B)	_mm_or_si128( _mm_and_si128( (M), (A) ), _mm_andnot_si128( (M), (B) ) )
+#define vec8_or_and(D,M,V)	_mm_or_si128( (D), _mm_and_si128( (M), (V) ) )
+#define vec8_dup(N)		_mm_set1_epi8( (char)(N) )
+#define vec16_load(P)		_mm_loadu_si128( (const __m128i *)(P) )
+#define vec16_store(P,V)	_mm_storeu_si128( (__m128i *)(P), (V) )
+#define vec16_select(M,A,B)	vec8_select( (M), (A), (B) )
+
+static inline vec8 mask_expand8( UINT32 m0, UINT32 m1 ){
+	const __m128i bits = _mm_set_epi8( 1,2,4,8,16,32,64,(char)0x80, 1,2,4,8,16,32,64,(char)0x80 );
+	__m128i v = _mm_unpacklo_epi64( _mm_set1_epi8( (char)m0 ), _mm_set1_epi8( (char)m1 ) );
+	return _mm_cmpeq_epi8( _mm_and_si128( v, bits ), bits );
+}
+static inline vec16 mask_expand16( UINT32 m ){
+	const __m128i bits = _mm_set_epi16( 1,2,4,8,16,32,64,0x80 );
+	return _mm_cmpeq_epi16( _mm_and_si128( _mm_set1_epi16( m ), bits ), bits );
+}
+
+static inline vec16 vec16_reverse( vec16 v ){
+	v = _mm_shufflelo_epi16( v, 0x1b );
+	v = _mm_shufflehi_epi16( v, 0x1b );
+	return _mm_shuffle_epi32( v, 0x4e );
+}
+static inline vec8 vec8_reverse_halves( vec8 v ){
+	v = _mm_or_si128( _mm_slli_epi16( v, 8 ), _mm_srli_epi16( v, 8 ) );
+	v = _mm_shufflelo_epi16( v, 0x1b );
+	return _mm_shufflehi_epi16( v, 0x1b );
+}
+static inline vec8 vec8_reverse( vec8 v ){
+	return _mm_shuffle_epi32( vec8_reverse_halves( v ), 0x4e );
+}
+
+/* no byte shuffle in SSE2: look the pens up in a 16 entry table and
+   assemble the vector from that */
+struct tile_lut {
+	UINT16 color[16];
+};
+
+static inline void lut_tables( struct tile_lut *lut, const UINT16 *paldata, UINT32 pen_usage ){
+	int pen;
+	for( pen=0; pen<16; pen++ )
+		lut->color[pen] = (pen_usage>>pen)&1 ? paldata[pen] : 0;
+}
+#define lut_init8(L,P,U)	lut_tables( (L), (P), (U) )
+#define lut_init16(L,P,U)	lut_tables( (L), (P), (U) )
+
+static inline vec8 lut_expand8( const struct tile_lut *lut, const UINT8 *p ){
+	const UINT16 *c = lut->color;
+	return _mm_setr_epi8( c[p[0]],c[p[1]],c[p[2]],c[p[3]],c[p[4]],c[p[5]],c[p[6]],c[p[7]],
+		c[p[8]],c[p[9]],c[p[10]],c[p[11]],c[p[12]],c[p[13]],c[p[14]],c[p[15]] );
+}
+static inline vec16 lut_expand16( const struct tile_lut *lut, const UINT8 *p ){
+	const UINT16 *c = lut->color;
+	return _mm_setr_epi16( c[p[0]],c[p[1]],c[p[2]],c[p[3]],c[p[4]],c[p[5]],c[p[6]],c[p[7]] );
+}
+
+#endif
+
+/* pens below 16 only, in one of the tile sizes tilemap_draw handles */
+#define TILE_SIMD_OK(W,H,U)	((U) && !((U)&0xffff0000) && ((W)==8 || (W)==16 || (W)==32) && !((H)&1))
+
+static void draw_tile8_simd( UINT8 **line, int sx, int sy, int dy, int width, int height,
+		const UINT8 *pendata, const UINT16 *paldata, UINT32 pen_usage, int flipx ){
+	struct tile_lut lut;
+	int x;
+	if( !TILE_SIMD_OK(width,height,pen_usage) ){
+		draw_tile8_c( line, sx, sy, dy, width, height, pendata, paldata, pen_usage, flipx );
+		return;
+	}
+	lut_init8( &lut, paldata, pen_usage );
+	if( width==8 ){
+		/* two rows per vector */
+		for( ; height; height-=2, sy+=2*dy, pendata+=16 ){
+			vec8 v = lut_expand8( &lut, pendata );
+			if( flipx ) v = vec8_reverse_halves( v );
+			vec8_store_lo( sx + line[sy], v );
+			vec8_store_hi( sx + line[sy+dy], v );
+		}
+	}
+	else {
+		for( ; height; height--, sy+=dy ){
+			UINT8 *dest = sx + line[sy];
+			for( x=0; x<width; x+=16, pendata+=16 ){
+				vec8 v = lut_expand8( &lut, pendata );
+				if( flipx ) vec8_store( dest+width-16-x, vec8_reverse( v ) );
+				else vec8_store( dest+x, v );
+			}
+		}
+	}
+}
+
+static void draw_tile16_simd( UINT8 **line, int sx, int sy, int dy, int width, int height,
+		const UINT8 *pendata, const UINT16 *paldata, UINT32 pen_usage, int flipx ){
+	struct tile_lut lut;
+	int x;
+	if( !TILE_SIMD_OK(width,height,pen_usage) ){
+		draw_tile16_c( line, sx, sy, dy, width, height, pendata, paldata, pen_usage, flipx );
+		return;
+	}
+	lut_init16( &lut, paldata, pen_usage );
+	for( ; height; height--, sy+=dy ){
+		UINT16 *dest = sx + (UINT16 *)line[sy];
+		for( x=0; x<width; x+=8, pendata+=8 ){
+			vec16 v = lut_expand16( &lut, pendata );
+			if( flipx ) vec16_store( dest+width-8-x, vec16_reverse( v ) );
+			else vec16_store( dest+x, v );
+		}
+	}
+}
+
+/* two mask bytes (16 pixels) per step; the pixels outside the mask are
+   read and written back unchanged, always within the same span */
+static void memsetbitmask8_simd( UINT8 *dest, int value, const UINT8 *bitmask, int count ){
+	vec8 v = vec8_dup( value );
+	for( ; count>=2; count-=2, bitmask+=2, dest+=16 ){
+		UINT32 data = bitmask[0] | (bitmask[1]<<8);
+		if( data==0xffff ) vec8_store( dest, vec8_or_and( vec8_load( dest ), vec8_dup( 0xff ), v ) );
+		else if( data ) vec8_store( dest, vec8_or_and( vec8_load( dest ), mask_expand8( bitmask[0], bitmask[1] ), v ) );
+	}
+	if( count ) memsetbitmask8_c( dest, value, bitmask, 1 );
+}
+
+static void memcpybitmask8_simd( UINT8 *dest, const UINT32 *source, const UINT8 *bitmask, int count ){
+	const UINT8 *src = (const UINT8 *)source;
+	for( ; count>=2; count-=2, bitmask+=2, src+=16, dest+=16 ){
+		UINT32 data = bitmask[0] | (bitmask[1]<<8);
+		if( data==0xffff ) vec8_store( dest, vec8_load( src ) );
+		else if( data ) vec8_store( dest, vec8_select( mask_expand8( bitmask[0], bitmask[1] ), vec8_load( src ), vec8_load( dest ) ) );
+	}
+	if( count ) memcpybitmask8_c( dest, (const UINT32 *)src, bitmask, 1 );
+}
+
+static void memcpybitmask16_simd( UINT16 *dest, const UINT32 *source, const UINT8 *bitmask, int count ){
+	const UINT16 *src = (const UINT16 *)source;
+	do{
+		UINT32 data = *bitmask++;
+		if( data==0xff ) vec16_store( dest, vec16_load( src ) );
+		else if( data ) vec16_store( dest, vec16_select( mask_expand16( data ), vec16_load( src ), vec16_load( dest ) ) );
+		src+=8;
+		dest+=8;
+		count--;
+	}while (count);
+}
+
+#endif /* TILEMAP_SIMD */
+
+/***********************************************************************************/
+
+struct tile_kernels {
+	void (*draw_tile8)( UINT8 **line, int sx, int sy, int dy, int width, int height,
+		const UINT8 *pendata, const UINT16 *paldata, UINT32 pen_usage, int flipx );
+	void (*draw_tile16)( UINT8 **line, int sx, int sy, int dy, int width, int height,
+		const UINT8 *pendata, const UINT16 *paldata, UINT32 pen_usage, int flipx );
+	void (*memsetbitmask8)( UINT8 *dest, int value, const UINT8 *bitmask, int count );
+	void (*memcpybitmask8)( UINT8 *dest, const UINT32 *source, const UINT8 *bitmask, int count );
+	void (*memcpybitmask16)( UINT16 *dest, const UINT32 *source, const UINT8 *bitmask, int count );
+};
+
+static const struct tile_kernels kernels_c = {
+	draw_tile8_c, draw_tile16_c, memsetbitmask8_c, memcpybitmask8_c, memcpybitmask16_c
+};
+#ifdef TILEMAP_SIMD
+static const struct tile_kernels kernels_simd = {
+	draw_tile8_simd, draw_tile16_simd, memsetbitmask8_simd, memcpybitmask8_simd, memcpybitmask16_simd
+};
+#endif
+static struct tile_kernels kernels = kernels_c;
+
+/***********************************************************************************/
+
+/* -tilemapcapture: log every kernel call with its inputs, so that
+   tilemap_benchmark() can replay real frames through each kernel set */
+
+FILE *tilemap_capture;
+static const struct tile_kernels *capture_next;
+static UINT32 capture_size;
+
+#define CAPTURE_MAX		(64<<20)	/* bytes; a few hundred frames of a busy game */
+
+struct capture_record {
+	UINT8 type, depth, width, height;
+	INT32 count;		/* palette entries for 'T', mask bytes otherwise */
+	UINT32 pen_usage;
+	INT32 param;		/* flipx | flipy<<1 for 'T', the priority value for 'S' */
+};
+
+static int capture_write( const struct capture_record *r, const void *a, int alen, const void *b, int blen, const void *c, int clen ){
+	if( capture_size + sizeof(*r)+alen+blen+clen > CAPTURE_MAX ){
+		if( capture_size<=CAPTURE_MAX ) logerror( "tilemap capture full\n" );
+		capture_size = CAPTURE_MAX+1;
+		return 0;
+	}
+	fwrite( r, sizeof(*r), 1, tilemap_capture );
+	if( alen ) fwrite( a, alen, 1, tilemap_capture );
+	if( blen ) fwrite( b, blen, 1, tilemap_capture );
+	if( clen ) fwrite( c, clen, 1, tilemap_capture );
+	capture_size += sizeof(*r)+alen+blen+clen;
+	return 1;
+}
+
+static void capture_tile( int depth, UINT8 **line, int sx, int sy, int dy, int width, int height,
+		const UINT8 *pendata, const UINT16 *paldata, UINT32 pen_usage, int flipx ){
+	struct capture_record r;
+	int i, pens = 0;
+	for( i=0; i<width*height; i++ ) if( pendata[i]>=pens ) pens = pendata[i]+1;
+	r.type = 'T'; r.depth = depth; r.width = width; r.height = height;
+	r.count = pens; r.pen_usage = pen_usage; r.param = flipx | (dy<0)<<1;
+	capture_write( &r, pendata, width*height, paldata, pens*sizeof(UINT16), 0, 0 );
+}
+static void capture_tile8( UINT8 **line, int sx, int sy, int dy, int width, int height,
+		const UINT8 *pendata, const UINT16 *paldata, UINT32 pen_usage, int flipx ){
+	capture_tile( 8, line, sx, sy, dy, width, height, pendata, paldata, pen_usage, flipx );
+	capture_next->draw_tile8( line, sx, sy, dy, width, height, pendata, paldata, pen_usage, flipx );
+}
+static void capture_tile16( UINT8 **line, int sx, int sy, int dy, int width, int height,
+		const UINT8 *pendata, const UINT16 *paldata, UINT32 pen_usage, int flipx ){
+	capture_tile( 16, line, sx, sy, dy, width, height, pendata, paldata, pen_usage, flipx );
+	capture_next->draw_tile16( line, sx, sy, dy, width, height, pendata, paldata, pen_usage, flipx );
+}
+static void capture_set8( UINT8 *dest, int value, const UINT8 *bitmask, int count ){
+	struct capture_record r = { 'S', 8, 0, 0, count, 0, value };
+	capture_write( &r, bitmask, count, dest, count*8, 0, 0 );
+	capture_next->memsetbitmask8( dest, value, bitmask, count );
+}
+static void capture_copy8( UINT8 *dest, const UINT32 *source, const UINT8 *bitmask, int count ){
+	struct capture_record r = { 'M', 8, 0, 0, count, 0, 0 };
+	capture_write( &r, bitmask, count, source, count*8, dest, count*8 );
+	capture_next->memcpybitmask8( dest, source, bitmask, count );
+}
+static void capture_copy16( UINT16 *dest, const UINT32 *source, const UINT8 *bitmask, int count ){
+	struct capture_record r = { 'M', 16, 0, 0, count, 0, 0 };
+	capture_write( &r, bitmask, count, source, count*16, dest, count*16 );
+	capture_next->memcpybitmask16( dest, source, bitmask, count );
+}
+
+static const struct tile_kernels kernels_capture = {
+	capture_tile8, capture_tile16, capture_set8, capture_copy8, capture_copy16
+};
+
+static void select_kernels( void ){
+	const struct tile_kernels *k = &kernels_c;
+#ifdef TILEMAP_SIMD
+	if( osd_cpu_has_simd() ) k = &kernels_simd;
+#endif
+	kernels = *k;
+	if( tilemap_capture ){
+		capture_next = k;
+		kernels = kernels_capture;
+		/* records go out in call order, so no workers while capturing */
+		tilemap_parallel = 0;
+	}
+}
+
+/* replay the 'T' (tile) or 'M' (masked copy and priority) records of a
+   capture through one kernel set; with hash set, also hash what was drawn.
+   Each kernel call runs reps times while its record is in the cache, so
+   streaming the capture from memory doesn't hide the kernel cost */
+static int replay_capture( const struct tile_kernels *k, const UINT8 *data, int size, int type, int reps, UINT32 *hash ){
+	static UINT16 pixels[32*32], palette[256], dest[256*16];
+	static UINT32 source[256*16/2];
+	UINT8 *line[32];
+	int pos = 0, records = 0, rep;
+
+	while( pos+(int)sizeof(struct capture_record)<=size ){
+		struct capture_record r;
+		const UINT8 *p = data+pos+sizeof(r);
+		const UINT8 *out = 0;
+		int len, bytes = 0, i;
+
+		memcpy( &r, data+pos, sizeof(r) );
+		if( r.type=='T' ){
+			int flipy = (r.param>>1)&1;
+			if( r.width>32 || r.height>32 || r.count>256 ) break;
+			len = r.width*r.height + r.count*sizeof(UINT16);
+			if( type=='T' ){
+				memcpy( palette, p+r.width*r.height, r.count*sizeof(UINT16) );
+				for( i=0; i<r.height; i++ ) line[i] = (UINT8 *)pixels + i*r.width*(r.depth/8);
+				for( rep=0; rep<reps; rep++ )
+					(r.depth==16 ? k->draw_tile16 : k->draw_tile8)( line, 0, flipy ? r.height-1 : 0, flipy ? -1 : 1,
+						r.width, r.height, p, palette, r.pen_usage, r.param&1 );
+				out = (const UINT8 *)pixels;
+				bytes = r.width*r.height*(r.depth/8);
+			}
+		}
+		else if( r.type=='M' || r.type=='S' ){
+			bytes = r.count*8*(r.depth/8);
+			if( r.count<=0 || bytes>(int)sizeof(dest) ) break;
+			len = r.count + (r.type=='M' ? 2*bytes : bytes);
+			if( type=='M' ){
+				memcpy( dest, p+len-bytes, bytes );
+				if( r.type=='M' ) memcpy( source, p+r.count, bytes );
+				/* both are idempotent, repeating them leaves the same result */
+				for( rep=0; rep<reps; rep++ ){
+					if( r.type=='S' )
+						k->memsetbitmask8( (UINT8 *)dest, r.param, p, r.count );
+					else if( r.depth==16 )
+						k->memcpybitmask16( dest, source, p, r.count );
+					else
+						k->memcpybitmask8( (UINT8 *)dest, source, p, r.count );
+				}
+				out = (const UINT8 *)dest;
+			}
+		}
+		else break;
+
+		if( out ){
+			records++;
+			if( hash ) while( bytes-- ) *hash = (*hash ^ *out++) * 16777619u;
+		}
+		pos += sizeof(r) + len;
+	}
+	return records;
+}
+
+#define BENCH_REPS	16
+
+/* -tilemapbench file */
+void tilemap_benchmark( const char *name ){
+	static const struct { const char *name; const struct tile_kernels *k; } sets[] = {
+		{ "scalar", &kernels_c },
+#ifdef TILEMAP_SIMD
+		{ TILEMAP_SIMD, &kernels_simd },
+#endif
+	};
+	static const struct { int type; const char *name; } kinds[] = {
+		{ 'T', "tiles" }, { 'M', "mask rows" }
+	};
+	UINT8 *data;
+	FILE *f;
+	int size, n, t;
+
+	if( (f = fopen( name, "rb" ))==0 ){
+		printf( "tilemapbench: can't open %s\n", name );
+		return;
+	}
+	fseek( f, 0, SEEK_END );
+	size = ftell( f );
+	fseek( f, 0, SEEK_SET );
+	data = (UINT8 *)malloc( size );
+	if( !data || fread( data, size, 1, f )!=1 ){
+		printf( "tilemapbench: can't read %s\n", name );
+		free( data );
+		fclose( f );
+		return;
+	}
+	fclose( f );
+
+	for( t=0; t<2; t++ ){
+		UINT32 reference = 0;
+		for( n=0; n<sizeof(sets)/sizeof(sets[0]); n++ ){
+			UINT32 hash = 2166136261u;
+			unsigned int start, elapsed;
+			int records;
+			if( n>0 && !osd_cpu_has_simd() ) break;
+			records = replay_capture( sets[n].k, data, size, kinds[t].type, 1, &hash );
+			start = osd_cycles();
+			replay_capture( sets[n].k, data, size, kinds[t].type, BENCH_REPS, 0 );
+			elapsed = osd_cycles()-start;
+			if( n==0 ) reference = hash;
+			printf( "tilemapbench: %-6s %8d %-9s %8u us per replay  output %s\n",
+				sets[n].name, records, kinds[t].name, elapsed/BENCH_REPS,
+				n==0 ? "reference" : hash==reference ? "same" : "DIFFERENT" );
+		}
+	}
+	free( data );
+}
+/***********************************************************************************/
+
 #define TILE_WIDTH	8
 #define TILE_HEIGHT	8
 #define DATA_TYPE UINT8
-#define memcpybitmask memcpybitmask8
+#define memcpybitmask kernels.memcpybitmask8
 #define DECLARE(function,args,body) static void function##8x8x8BPP args body
 #include "tilemap_draw.h"
 
 #define TILE_WIDTH	16
 #define TILE_HEIGHT	16
 #define DATA_TYPE UINT8
-#define memcpybitmask memcpybitmask8
+#define memcpybitmask kernels.memcpybitmask8
 #define DECLARE(function,args,body) static void function##16x16x8BPP args body
 #include "tilemap_draw.h"
 
 #define TILE_WIDTH	32
 #define TILE_HEIGHT	32
 #define DATA_TYPE UINT8
-#define memcpybitmask memcpybitmask8
+#define memcpybitmask kernels.memcpybitmask8
 #define DECLARE(function,args,body) static void function##32x32x8BPP args body
 #include "tilemap_draw.h"
 
 #define TILE_WIDTH	8
 #define TILE_HEIGHT	8
 #define DATA_TYPE UINT16
-#define memcpybitmask memcpybitmask16
+#define memcpybitmask kernels.memcpybitmask16
 #define DECLARE(function,args,body) static void function##8x8x16BPP args body
 #include "tilemap_draw.h"
 
 #define TILE_WIDTH	16
 #define TILE_HEIGHT	16
 #define DATA_TYPE UINT16
-#define memcpybitmask memcpybitmask16
+#define memcpybitmask kernels.memcpybitmask16
 #define DECLARE(function,args,body) static void function##16x16x16BPP args body
 #include "tilemap_draw.h"
 
 #define TILE_WIDTH	32
 #define TILE_HEIGHT	32
 #define DATA_TYPE UINT16
-#define memcpybitmask memcpybitmask16
+#define memcpybitmask kernels.memcpybitmask16
 #define DECLARE(function,args,body) static void function##32x32x16BPP args body
 #include "tilemap_draw.h"
 
@@ -402,6 +923,7 @@ int tilemap_init( void ){
 	screen_width = Machine->scrbitmap->width;
 	screen_height = Machine->scrbitmap->height;
 	first_tilemap = 0;
+	select_kernels();
 	priority_bitmap = create_tmpbitmap( screen_width, screen_height, 8 );
 	if( priority_bitmap ){
 		priority_bitmap_line_offset = priority_bitmap->line[1] - priority_bitmap->line[0];
@@ -462,16 +984,15 @@ struct tilemap *tilemap_create(
 		tilemap->priority = (UINT8*)malloc( num_tiles * 1 );
 		if (tilemap->priority)
 			memset(tilemap->priority, 0, num_tiles);
-#if USE_VISIBLE
-		tilemap->visible = (UINT8*)malloc( num_tiles * 1 );
-		if (tilemap->visible)
-			memset(tilemap->visible, 0, num_tiles);
-#endif
 		//tilemap->cached_tile_info = (struct cached_tile_info*)calloc( num_tiles, sizeof(struct cached_tile_info) );
 		//tilemap->priority = (UINT8*)calloc( num_tiles,1 );
-		//tilemap->visible = (UINT8*)calloc( num_tiles,1 );
-		tilemap->dirty_vram = (UINT8*)malloc( num_tiles );
-		tilemap->dirty_pixels = (UINT8*)malloc( num_tiles );
+		tilemap->dirty_words = BIT_WORDS(num_cols);
+		tilemap->dirty_vram = (UINT32*)malloc( num_rows*tilemap->dirty_words*sizeof(UINT32) );
+		tilemap->dirty_pixels = (UINT32*)malloc( num_rows*tilemap->dirty_words*sizeof(UINT32) );
+		tilemap->visible_rows = (UINT32*)calloc( BIT_WORDS(num_rows), sizeof(UINT32) );
+		tilemap->visible_cols = (UINT32*)calloc( BIT_WORDS(num_cols), sizeof(UINT32) );
+		tilemap->draw_rows = (UINT32*)calloc( BIT_WORDS(num_rows), sizeof(UINT32) );
+		tilemap->draw_cols = (UINT32*)calloc( BIT_WORDS(num_cols), sizeof(UINT32) );
 		//tilemap->rowscroll = (int*)calloc(tilemap->cached_height,sizeof(int));
 		//tilemap->colscroll = (int*)calloc(tilemap->cached_width,sizeof(int));
 		tilemap->rowscroll = (int*)malloc(tilemap->cached_height * sizeof(int));
@@ -485,10 +1006,9 @@ struct tilemap *tilemap_create(
 		tilemap->foreground = mask_create( tilemap );
 		tilemap->background = (type & TILEMAP_SPLIT)?mask_create( tilemap ):NULL;
 		if( tilemap->cached_tile_info && tilemap->priority &&
-#if USE_VISIBLE
-			tilemap->visible &&
-#endif
 			tilemap->dirty_vram && tilemap->dirty_pixels &&
+			tilemap->visible_rows && tilemap->visible_cols &&
+			tilemap->draw_rows && tilemap->draw_cols &&
 			tilemap->rowscroll && tilemap->colscroll &&
 			tilemap->priority_row &&
 			tilemap->pixmap && tilemap->foreground &&
@@ -502,8 +1022,8 @@ struct tilemap *tilemap_create(
 			install_draw_handlers( tilemap );
 			mappings_update( tilemap );
 			tilemap_set_clip( tilemap, &Machine->visible_area );
-			memset( tilemap->dirty_vram, 1, num_tiles );
-			memset( tilemap->dirty_pixels, 1, num_tiles );
+			memset( tilemap->dirty_vram, 0xff, num_rows*tilemap->dirty_words*sizeof(UINT32) );
+			memset( tilemap->dirty_pixels, 0xff, num_rows*tilemap->dirty_words*sizeof(UINT32) );
 			tilemap->pixmap_line_offset = tilemap->pixmap->line[1] - tilemap->pixmap->line[0];
 			tilemap->next = first_tilemap;
 			first_tilemap = tilemap;
@@ -526,11 +1046,12 @@ void tilemap_dispose( struct tilemap *tilemap ){
 
 	free( tilemap->cached_tile_info );
 	free( tilemap->priority );
-#if USE_VISIBLE
-	free( tilemap->visible );
-#endif
 	free( tilemap->dirty_vram );
 	free( tilemap->dirty_pixels );
+	free( tilemap->visible_rows );
+	free( tilemap->visible_cols );
+	free( tilemap->draw_rows );
+	free( tilemap->draw_cols );
 	free( tilemap->rowscroll );
 	free( tilemap->colscroll );
 	free( tilemap->priority_row );
@@ -705,10 +1226,8 @@ void tilemap_set_scroll_rows( struct tilemap *tilemap, int n ){
 
 void tilemap_mark_tile_dirty( struct tilemap *tilemap, int memory_offset ){
 	if( memory_offset<tilemap->max_memory_offset ){
-		int cached_index = tilemap->memory_offset_to_cached_index[memory_offset];
-		if( cached_index>=0 ){
-			tilemap->dirty_vram[cached_index] = 1;
-		}
+		int bit = tilemap->memory_offset_to_dirty_bit[memory_offset];
+		if( bit>=0 ) BIT_SET( tilemap->dirty_vram, bit );
 	}
 }
 
@@ -721,7 +1240,7 @@ void tilemap_mark_all_tiles_dirty( struct tilemap *tilemap ){
 		}
 	}
 	else {
-		memset( tilemap->dirty_vram, 1, tilemap->num_tiles );
+		memset( tilemap->dirty_vram, 0xff, tilemap->num_cached_rows*tilemap->dirty_words*sizeof(UINT32) );
 	}
 }
 
@@ -734,20 +1253,7 @@ void tilemap_mark_all_pixels_dirty( struct tilemap *tilemap ){
 		}
 	}
 	else {
-		/* invalidate all offscreen tiles */
-#if USE_VISIBLE
-		UINT32 cached_tile_index;
-		UINT32 num_pens = tilemap->cached_tile_width*tilemap->cached_tile_height;
-		for( cached_tile_index=0; cached_tile_index<tilemap->num_tiles; cached_tile_index++ ){
-			if( !tilemap->visible[cached_tile_index] ){
-				unregister_pens( &tilemap->cached_tile_info[cached_tile_index], num_pens );
-				tilemap->dirty_vram[cached_tile_index] = 1;
-			}
-		}
-#else
-		//memset( tilemap->dirty_vram, 1, tilemap->num_tiles );
-#endif
-		memset( tilemap->dirty_pixels, 1, tilemap->num_tiles );
+		memset( tilemap->dirty_pixels, 0xff, tilemap->num_cached_rows*tilemap->dirty_words*sizeof(UINT32) );
 	}
 }
 
@@ -762,65 +1268,61 @@ static inline void draw_tile(
 	UINT32 tile_width = tilemap->cached_tile_width;
 	UINT32 tile_height = tilemap->cached_tile_height;
 	struct cached_tile_info *cached_tile_info = &tilemap->cached_tile_info[cached_index];
-	const UINT8 *pendata = cached_tile_info->pen_data;
-	const UINT16 *paldata = cached_tile_info->pal_data;
-
 	UINT32 flags = cached_tile_info->flags;
-	int x, sx = tile_width*col;
-	int sy,y1,y2,dy;
+	int sy = tile_height*row;
+	int dy = 1;
 
-	if( Machine->scrbitmap->depth==16 ){
-		if( flags&TILE_FLIPY ){
-			y1 = tile_height*row+tile_height-1;
-			y2 = y1-tile_height;
-	 		dy = -1;
-	 	}
-	 	else {
-			y1 = tile_height*row;
-			y2 = y1+tile_height;
-	 		dy = 1;
-	 	}
-
-		if( flags&TILE_FLIPX ){
-			tile_width--;
-			for( sy=y1; sy!=y2; sy+=dy ){
-				UINT16 *dest  = sx + (UINT16 *)pixmap->line[sy];
-				for( x=tile_width; x>=0; x-- ) dest[x] = paldata[*pendata++];
-			}
-		}
-		else {
-			for( sy=y1; sy!=y2; sy+=dy ){
-				UINT16 *dest  = sx + (UINT16 *)pixmap->line[sy];
-				for( x=0; x<tile_width; x++ ) dest[x] = paldata[*pendata++];
+	if( flags&TILE_FLIPY ){
+		sy += tile_height-1;
+		dy = -1;
+	}
+	(Machine->scrbitmap->depth==16 ? kernels.draw_tile16 : kernels.draw_tile8)(
+		pixmap->line, tile_width*col, sy, dy, tile_width, tile_height,
+		cached_tile_info->pen_data, cached_tile_info->pal_data,
+		cached_tile_info->pen_usage, flags&TILE_FLIPX );
+}
+
+/* redraw the visible tiles whose pixels are dirty; the others wait */
+static void render_rows( void *param, int start, int end ){
+	struct tilemap *tilemap = (struct tilemap *)param;
+	const UINT32 *visible_cols = tilemap->visible_cols;
+	UINT32 words = tilemap->dirty_words;
+	UINT32 row,w;
+
+	for( row=start; row<end; row++ ){
+		UINT32 *dirty = tilemap->dirty_pixels+row*words;
+		if( !BIT_TEST(tilemap->visible_rows,row) ) continue;
+		for( w=0; w<words; w++ ){
+			UINT32 bits = dirty[w] & visible_cols[w];
+			dirty[w] &= ~bits;
+			while( bits ){
+				UINT32 col = (w<<5) + __builtin_ctz( bits );
+				bits &= bits-1;
+				draw_tile( tilemap, row*tilemap->num_cached_cols+col, col, row );
 			}
 		}
 	}
-	else {
-		if( flags&TILE_FLIPY ){
-			y1 = tile_height*row+tile_height-1;
-			y2 = y1-tile_height;
-	 		dy = -1;
-	 	}
-	 	else {
-			y1 = tile_height*row;
-			y2 = y1+tile_height;
-	 		dy = 1;
-	 	}
-
-		if( flags&TILE_FLIPX ){
-			tile_width--;
-			for( sy=y1; sy!=y2; sy+=dy ){
-				UINT8 *dest  = sx + (UINT8 *)pixmap->line[sy];
-				for( x=tile_width; x>=0; x-- ) dest[x] = paldata[*pendata++];
-			}
+}
+
+/* every tile owns its own pixmap rectangle, so rows can go to different workers */
+static void render_pixels( struct tilemap *tilemap ){
+	int rows = tilemap->num_cached_rows;
+	if( tilemap_parallel && rows>1 && osd_parallel_workers()>1 ){
+		UINT32 words = tilemap->dirty_words;
+		int count = 0;
+		int row;
+		UINT32 w;
+		for( row=0; row<rows && count<RENDER_PARALLEL_MIN; row++ ){
+			if( !BIT_TEST(tilemap->visible_rows,row) ) continue;
+			for( w=0; w<words; w++ )
+				count += __builtin_popcount( tilemap->dirty_pixels[row*words+w] & tilemap->visible_cols[w] );
 		}
-		else {
-			for( sy=y1; sy!=y2; sy+=dy ){
-				UINT8 *dest  = sx + (UINT8 *)pixmap->line[sy];
-				for( x=0; x<tile_width; x++ ) dest[x] = paldata[*pendata++];
-			}
+		if( count>=RENDER_PARALLEL_MIN ){
+			osd_parallel_for( rows, render_rows, tilemap );
+			return;
 		}
 	}
+	render_rows( tilemap, 0, rows );
 }
 
 void tilemap_render( struct tilemap *tilemap ){
@@ -833,27 +1335,7 @@ profiler_mark(PROFILER_TILEMAP_RENDER);
 		}
 	}
 	else if( tilemap->enable ){
-		UINT8 *dirty_pixels = tilemap->dirty_pixels;
-#if USE_VISIBLE
-		const UINT8 *visible = tilemap->visible;
-#endif
-		UINT32 cached_index = 0;
-		UINT32 row,col;
-
-		/* walk over cached rows/cols (better to walk screen coords) */
-		for( row=0; row<tilemap->num_cached_rows; row++ ){
-			for( col=0; col<tilemap->num_cached_cols; col++ ){
-#if USE_VISIBLE
-				if( visible[cached_index] && dirty_pixels[cached_index] ){
-#else
-				if( dirty_pixels[cached_index] ){
-#endif
-					draw_tile( tilemap, cached_index, col, row );
-					dirty_pixels[cached_index] = 0;
-				}
-				cached_index++;
-			} /* next col */
-		} /* next row */
+		render_pixels( tilemap );
 	}
 profiler_mark(PROFILER_END);
 }
@@ -1214,54 +1696,121 @@ static void render_mask( struct tilemap *tilemap, UINT32 cached_index ){
 	}
 }
 
+/*
+	fetch every tile whose vram changed. This has to happen before the
+	driver's palette_recalc(), so it isn't culled like the rendering:
+	a tile that scrolls into view later must already have its pens
+	registered.
+*/
 static void update_tile_info( struct tilemap *tilemap ){
 	int *logical_flip_to_cached_flip = tilemap->logical_flip_to_cached_flip;
 	UINT32 num_pens = tilemap->cached_tile_width*tilemap->cached_tile_height;
-	UINT32 num_tiles = tilemap->num_tiles;
-	UINT32 cached_index;
-#if USE_VISIBLE
-	UINT8 *visible = tilemap->visible;
-#endif
-	UINT8 *dirty_vram = tilemap->dirty_vram;
-	UINT8 *dirty_pixels = tilemap->dirty_pixels;
+	UINT32 words = tilemap->dirty_words;
+	/* mark_all sets the padding bits past the last column too */
+	UINT32 tail = tilemap->num_cached_cols&31;
+	UINT32 last_mask = tail ? (1u<<tail)-1 : ~0u;
+	UINT32 row,w;
 	tile_info.flags = 0;
 	tile_info.priority = 0;
-	for( cached_index=0; cached_index<num_tiles; cached_index++ ){
-#if USE_VISIBLE
-		if( visible[cached_index] && dirty_vram[cached_index] ){
-#else
-		if( dirty_vram[cached_index] ){
-#endif
-			struct cached_tile_info *cached_tile_info = &tilemap->cached_tile_info[cached_index];
+	for( row=0; row<tilemap->num_cached_rows; row++ ){
+		UINT32 *dirty_vram = tilemap->dirty_vram+row*words;
+		UINT32 *dirty_pixels = tilemap->dirty_pixels+row*words;
+		for( w=0; w<words; w++ ){
+			UINT32 bits = dirty_vram[w] & (w==words-1 ? last_mask : ~0u);
+			dirty_vram[w] = 0;
+			dirty_pixels[w] |= bits;
+			while( bits ){
+				UINT32 cached_index = row*tilemap->num_cached_cols + (w<<5) + __builtin_ctz( bits );
+				struct cached_tile_info *cached_tile_info = &tilemap->cached_tile_info[cached_index];
 #if NOT_USE_CACHED_INDEX_TO_MEMORY_OFFSET
-			UINT32 memory_offset = tilemap->get_memory_offset( cached_index%tilemap->num_logical_cols, cached_index/tilemap->num_logical_cols, tilemap->num_logical_cols, tilemap->num_logical_rows );
+				UINT32 memory_offset = tilemap->get_memory_offset( cached_index%tilemap->num_logical_cols, cached_index/tilemap->num_logical_cols, tilemap->num_logical_cols, tilemap->num_logical_rows );
 #else
-			UINT32 memory_offset = tilemap->cached_index_to_memory_offset[cached_index];
+				UINT32 memory_offset = tilemap->cached_index_to_memory_offset[cached_index];
 #endif
-			unregister_pens( cached_tile_info, num_pens );
-			tilemap->tile_get_info( memory_offset );
-			{
-				UINT32 flags = tile_info.flags;
-				cached_tile_info->flags = (flags&0xfc)|logical_flip_to_cached_flip[flags&0x3];
+				bits &= bits-1;
+				unregister_pens( cached_tile_info, num_pens );
+				tilemap->tile_get_info( memory_offset );
+				{
+					UINT32 flags = tile_info.flags;
+					cached_tile_info->flags = (flags&0xfc)|logical_flip_to_cached_flip[flags&0x3];
+				}
+				cached_tile_info->pen_usage = tile_info.pen_usage;
+				cached_tile_info->pen_data = tile_info.pen_data;
+				cached_tile_info->pal_data = tile_info.pal_data;
+				tilemap->priority[cached_index] = tile_info.priority;
+				register_pens( cached_tile_info, num_pens );
+				render_mask( tilemap, cached_index );
 			}
-			cached_tile_info->pen_usage = tile_info.pen_usage;
-			cached_tile_info->pen_data = tile_info.pen_data;
-			cached_tile_info->pal_data = tile_info.pal_data;
-			tilemap->priority[cached_index] = tile_info.priority;
-			register_pens( cached_tile_info, num_pens );
-			dirty_pixels[cached_index] = 1;
-			dirty_vram[cached_index] = 0;
-			render_mask( tilemap, cached_index );
 		}
 	}
 }
 
-#if USE_VISIBLE
-static void update_visible( struct tilemap *tilemap ){
-	// temporary hack
-	memset( tilemap->visible, 1, tilemap->num_tiles );
+/* mark the tiles under pixels start..start+count-1 of a line that wraps every size pixels */
+static void mark_span( UINT32 *bits, int start, int count, int size, int tile_size ){
+	int num_tiles = size/tile_size;
+	int first,last,i;
+	if( count<=0 ) return;
+	if( count>=size ){
+		first = 0;
+		last = size-1;
+	}
+	else {
+		first = start%size;
+		if( first<0 ) first += size;
+		last = first+count-1;
+	}
+	for( i=first/tile_size; i<=last/tile_size; i++ ){
+		BIT_SET( bits, i<num_tiles ? i : i-num_tiles );
+	}
+}
+
+/*
+	Rows and columns of the cached tilemap that tilemap_draw will look at
+	with the current scroll and clip. A single scroll value per axis gives
+	an exact span; per-row or per-column scrolling makes the other axis
+	wholly visible.
+*/
+static void get_visible( struct tilemap *tilemap, UINT32 *rows, UINT32 *cols ){
+	int width = tilemap->cached_width;
+	int height = tilemap->cached_height;
+	memset( rows, 0, BIT_WORDS(tilemap->num_cached_rows)*sizeof(UINT32) );
+	memset( cols, 0, BIT_WORDS(tilemap->num_cached_cols)*sizeof(UINT32) );
+	if( tilemap->scroll_rows==1 ){
+		mark_span( cols, tilemap->clip_left-tilemap->rowscroll[0],
+			tilemap->clip_right-tilemap->clip_left, width, tilemap->cached_tile_width );
+	}
+	else {
+		mark_span( cols, 0, width, width, tilemap->cached_tile_width );
+	}
+	if( tilemap->scroll_cols==1 ){
+		mark_span( rows, tilemap->clip_top-tilemap->colscroll[0],
+			tilemap->clip_bottom-tilemap->clip_top, height, tilemap->cached_tile_height );
+	}
+	else {
+		mark_span( rows, 0, height, height, tilemap->cached_tile_height );
+	}
+}
+
+/*
+	tilemap_draw with a scroll or clip the last tilemap_update didn't see
+	(drivers that scroll after updating, or draw one layer several times)
+	renders the missing tiles before drawing. Their tile info was already
+	fetched by tilemap_update.
+*/
+static void update_for_draw( struct tilemap *tilemap ){
+	UINT32 row_words = BIT_WORDS(tilemap->num_cached_rows);
+	UINT32 col_words = tilemap->dirty_words;
+	UINT32 missing = 0;
+	UINT32 i;
+	get_visible( tilemap, tilemap->draw_rows, tilemap->draw_cols );
+	for( i=0; i<row_words; i++ ) missing |= tilemap->draw_rows[i] & ~tilemap->visible_rows[i];
+	for( i=0; i<col_words; i++ ) missing |= tilemap->draw_cols[i] & ~tilemap->visible_cols[i];
+	if( missing ){
+		for( i=0; i<row_words; i++ ) tilemap->visible_rows[i] |= tilemap->draw_rows[i];
+		for( i=0; i<col_words; i++ ) tilemap->visible_cols[i] |= tilemap->draw_cols[i];
+		render_pixels( tilemap );
+	}
 }
-#endif
 
 void tilemap_update( struct tilemap *tilemap ){
 profiler_mark(PROFILER_TILEMAP_UPDATE);
@@ -1273,9 +1822,7 @@ profiler_mark(PROFILER_TILEMAP_UPDATE);
 		}
 	}
 	else if( tilemap->enable ){
-#if USE_VISIBLE
-		update_visible( tilemap );
-#endif
+		get_visible( tilemap, tilemap->visible_rows, tilemap->visible_cols );
 		update_tile_info( tilemap );
 	}
 profiler_mark(PROFILER_END);
@@ -1333,6 +1880,52 @@ void tilemap_set_scrolly( struct tilemap *tilemap, int which, int value ){
 }
 /***********************************************************************************/
 
+static void queue_draw( int xpos, int ypos ){
+	struct draw_call *call;
+	if( num_draw_calls==max_draw_calls ){
+		int max = max_draw_calls ? max_draw_calls*2 : 64;
+		struct draw_call *calls = (struct draw_call *)realloc( draw_calls, max*sizeof(struct draw_call) );
+		if( !calls ){
+			draw_func( xpos, ypos );
+			return;
+		}
+		draw_calls = calls;
+		max_draw_calls = max;
+	}
+	call = &draw_calls[num_draw_calls++];
+	call->xpos = xpos;
+	call->ypos = ypos;
+	call->clip_left = blit.clip_left;
+	call->clip_top = blit.clip_top;
+	call->clip_right = blit.clip_right;
+	call->clip_bottom = blit.clip_bottom;
+}
+
+/* play the recorded calls back, clipped to lines top..bottom-1 */
+static void draw_band( int top, int bottom ){
+	const struct draw_call *call = draw_calls;
+	int i;
+	for( i=0; i<num_draw_calls; i++, call++ ){
+		blit.clip_left = call->clip_left;
+		blit.clip_right = call->clip_right;
+		blit.clip_top = call->clip_top>top ? call->clip_top : top;
+		blit.clip_bottom = call->clip_bottom<bottom ? call->clip_bottom : bottom;
+		if( blit.clip_top<blit.clip_bottom ) draw_func( call->xpos, call->ypos );
+	}
+}
+
+/* a band writes only its own lines of the screen and of priority_bitmap */
+static void draw_bands( void *param, int start, int end ){
+	int band;
+	blit = draw_blit;
+	for( band=start; band<end; band++ ){
+		int top = band_top + band*band_height;
+		int bottom = top + band_height;
+		if( bottom>band_bottom ) bottom = band_bottom;
+		draw_band( top, bottom );
+	}
+}
+
 void tilemap_draw( struct osd_bitmap *dest, struct tilemap *tilemap, UINT32 priority ){
 	int xpos,ypos;
 
@@ -1352,6 +1945,11 @@ profiler_mark(PROFILER_TILEMAP_DRAW);
 
 		int tile_height = tilemap->cached_tile_height;
 
+		update_for_draw( tilemap );
+		num_draw_calls = 0;
+
+		mark_dirty_bitmap( dest, left, top, right-1, bottom-1 );
+
 		blit.screen = dest;
 		blit.dest_line_offset = dest->line[1] - dest->line[0];
 
@@ -1390,6 +1988,7 @@ profiler_mark(PROFILER_TILEMAP_DRAW);
 		blit.source_height = tilemap->cached_height;
 		blit.tile_priority = priority&0xf;
 		blit.tilemap_priority_code = priority>>16;
+		draw_func = draw;
 
 		if( rows == 1 && cols == 1 ){ /* XY scrolling playfield */
 			int scrollx = rowscroll[0];
@@ -1424,7 +2023,7 @@ profiler_mark(PROFILER_TILEMAP_DRAW);
 					xpos < blit.clip_right;
 					xpos += blit.source_width
 				){
-					draw( xpos,ypos );
+					queue_draw( xpos,ypos );
 				}
 			}
 		}
@@ -1468,7 +2067,7 @@ profiler_mark(PROFILER_TILEMAP_DRAW);
 						ypos < blit.clip_bottom;
 						ypos += blit.source_height
 					){
-						draw( scrollx,ypos );
+						queue_draw( scrollx,ypos );
 					}
 
 					blit.clip_left = col * colwidth + scrollx - blit.source_width;
@@ -1481,7 +2080,7 @@ profiler_mark(PROFILER_TILEMAP_DRAW);
 						ypos < blit.clip_bottom;
 						ypos += blit.source_height
 					){
-						draw( scrollx - blit.source_width,ypos );
+						queue_draw( scrollx - blit.source_width,ypos );
 					}
 				}
 				col += cons;
@@ -1520,7 +2119,7 @@ profiler_mark(PROFILER_TILEMAP_DRAW);
 						xpos < blit.clip_right;
 						xpos += blit.source_width
 					){
-						draw( xpos,scrolly );
+						queue_draw( xpos,scrolly );
 					}
 					blit.clip_top = row * rowheight + scrolly - blit.source_height;
 					if (blit.clip_top < top) blit.clip_top = top;
@@ -1531,12 +2130,25 @@ profiler_mark(PROFILER_TILEMAP_DRAW);
 						xpos < blit.clip_right;
 						xpos += blit.source_width
 					){
-						draw( xpos,scrolly - blit.source_height );
+						queue_draw( xpos,scrolly - blit.source_height );
 					}
 				}
 				row += cons;
 			}
 		}
+
+		if( tilemap_parallel && bottom-top>=2*DRAW_BAND_MIN && osd_parallel_workers()>1 ){
+			int bands = (bottom-top)/DRAW_BAND_MIN;
+			if( bands>2*osd_parallel_workers() ) bands = 2*osd_parallel_workers();
+			band_top = top;
+			band_bottom = bottom;
+			band_height = (bottom-top+bands-1)/bands;
+			draw_blit = blit;
+			osd_parallel_for( bands, draw_bands, 0 );
+		}
+		else {
+			draw_band( top, bottom );
+		}
 	}
 profiler_mark(PROFILER_END);
 }
@@ -99,7 +99,7 @@ struct tilemap_mask {
 
 struct tilemap {
 	UINT32 (*get_memory_offset)( UINT32 col, UINT32 row, UINT32 num_cols, UINT32 num_rows );
-	int *memory_offset_to_cached_index;
+	int *memory_offset_to_dirty_bit;	/* row*dirty_words*32+col, -1 if unused */
 #if NOT_USE_CACHED_INDEX_TO_MEMORY_OFFSET
 #else
 	UINT32 *cached_index_to_memory_offset;
@@ -135,13 +135,15 @@ struct tilemap {
 	UINT8 *priority,	/* priority for each tile */
 		**priority_row;
 
-#if USE_VISIBLE
-	UINT8 *visible; /* boolean flag for each tile */
-#endif
-
-	UINT8 *dirty_vram; /* boolean flag for each tile */
+	/* one bit per tile, each cached row padded to dirty_words words */
+	UINT32 *dirty_vram;
+	UINT32 *dirty_pixels;
+	int dirty_words;
 
-	UINT8 *dirty_pixels;
+	/* rows and columns seen through the clip rect at the last tilemap_update,
+	   and for the tilemap_draw in progress */
+	UINT32 *visible_rows, *visible_cols;
+	UINT32 *draw_rows, *draw_cols;
 
 	int scroll_rows, scroll_cols;
 	int *rowscroll, *colscroll;
@@ -207,6 +209,9 @@ void tilemap_update( struct tilemap *tilemap );
 void tilemap_render( struct tilemap *tilemap );
 void tilemap_draw( struct osd_bitmap *dest, struct tilemap *tilemap, UINT32 priority );
 
+/* replay a -tilemapcapture file through the scalar and SIMD kernels */
+void tilemap_benchmark( const char *name );
+
 /*********************************************************************/
 
 UINT32 tilemap_scan_cols( UINT32 col, UINT32 row, UINT32 num_cols, UINT32 num_rows );
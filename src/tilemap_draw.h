@@ -113,7 +113,7 @@ DECLARE( draw, (int xpos, int ypos),
 							int i = y;
 							for(;;){
 								memcpybitmask( dest0, (UINT32 *)source0, mask0, count );
-								memsetbitmask8( pmap0, tilemap_priority_code, mask0, count );
+								kernels.memsetbitmask8( pmap0, tilemap_priority_code, mask0, count );
 								if( ++i == y_next ) break;
 
 								dest0 += blit.dest_line_offset;
@@ -28,14 +28,34 @@
 	  burn cycles, because the cores might need to adjust internal
 	  counters or timers.
 
+  Active timers are kept in a binary min-heap instead of a sorted linked
+  list, so timer_set/timer_pulse/timer_reset are O(log n). Timers are
+  ordered by expire time (TIME_NEVER while disabled) and, for equal
+  times, by the order they were inserted, exactly as the list did.
+
+  A CPU marked as deferred (see cpu_defer()) can also get events from the
+  other CPUs through a small per-CPU journal instead of a TIME_NOW timer.
+  The writer keeps running; the deferred CPU stops at each journaled time
+  when it gets there and the event is delivered then, so it sees it at the
+  same point of its own execution as it would have.
+
 ***************************************************************************/
 
 #include "cpuintrf.h"
 #include "driver.h"
 #include "timer.h"
+#include "osinline.h"
 
 #define MAX_TIMERS 256
 
+#ifdef TIMER_64BIT
+/* cycles_to_sec fits in 31 bits for any clock above 512Hz, so converting
+   cycles to time stays a single 32x32->64 multiply on ARM32 */
+#define CYCLES_TO_TIME(n,c) ((timer_tm)(INT32)(n) * (INT32)(c))
+#else
+#define CYCLES_TO_TIME(n,c) ((timer_tm)(n) * (c))
+#endif
+
 /*
  *		internal timer structures
  */
@@ -66,16 +86,34 @@ static cpu_entry *lastcpu;
 static cpu_entry *activecpu;
 static cpu_entry *last_activecpu;
 
-/* list of active timers */
+/* heap of active timers, the next one to fire is timer_heap[0] */
 static timer_entry timers[MAX_TIMERS];
-static timer_entry *timer_head;
+static timer_entry *timer_heap[MAX_TIMERS];
+static int timer_heap_count;
+static UINT32 timer_seq;
 static timer_entry *timer_free_head;
 
+#define timer_head (timer_heap[0])
+
 /* other internal states */
 static timer_tm base_time;
 static timer_tm global_offset;
 static timer_entry *callback_timer;
 static int callback_timer_modified;
+static int sync_count;		/* TIME_NOW timers and triggers from a running CPU */
+
+/* events waiting for a deferred CPU to catch up, in time order */
+#define MAX_DEFERRED 32
+
+typedef struct
+{
+	timer_tm time;
+	void (*callback)(int);
+	int param;
+} deferred_event;
+
+static deferred_event deferred[MAX_CPU][MAX_DEFERRED];
+static int deferred_count[MAX_CPU];
 
 /* prototypes */
 static int pick_cpu(int *cpu, int *cycles, timer_tm expire);
@@ -86,7 +124,7 @@ static int pick_cpu(int *cpu, int *cycles, timer_tm expire);
 timer_tm getabsolutetime(void)
 {
 	if (activecpu && (*activecpu->icount + activecpu->lost) > 0)
-		return base_time - ((timer_tm)(*activecpu->icount + activecpu->lost) * activecpu->cycles_to_sec);
+		return base_time - CYCLES_TO_TIME(*activecpu->icount + activecpu->lost, activecpu->cycles_to_sec);
 	else
 		return base_time;
 }
@@ -138,89 +176,78 @@ INLINE timer_entry *timer_new(void)
 
 
 /*
- *		insert a new timer into the list at the appropriate location
+ *		heap ordering: earlier key first, insertion order on a tie
+ */
+INLINE int timer_before(const timer_entry *a, const timer_entry *b)
+{
+	if (a->key != b->key)
+		return a->key < b->key;
+	return (INT32)(a->seq - b->seq) < 0;
+}
+
+INLINE void timer_heap_up(int i, timer_entry *timer)
+{
+	while (i > 0)
+	{
+		int parent = (i - 1) >> 1;
+		if (!timer_before(timer, timer_heap[parent]))
+			break;
+		timer_heap[i] = timer_heap[parent];
+		timer_heap[i]->heap_index = i;
+		i = parent;
+	}
+	timer_heap[i] = timer;
+	timer->heap_index = i;
+}
+
+INLINE void timer_heap_down(int i, timer_entry *timer)
+{
+	for (;;)
+	{
+		int child = 2 * i + 1;
+		if (child >= timer_heap_count)
+			break;
+		if (child + 1 < timer_heap_count && timer_before(timer_heap[child + 1], timer_heap[child]))
+			child++;
+		if (!timer_before(timer_heap[child], timer))
+			break;
+		timer_heap[i] = timer_heap[child];
+		timer_heap[i]->heap_index = i;
+		i = child;
+	}
+	timer_heap[i] = timer;
+	timer->heap_index = i;
+}
+
+
+/*
+ *		insert a new timer into the heap at the appropriate location
  */
 INLINE void timer_list_insert(timer_entry *timer)
 {
-	timer_entry *t=timer_head;
-	timer_entry *lt = NULL;
-    timer_tm expire = (t && timer->enabled) ? timer->expire : TIME_NEVER;
-
-    if (expire==TIME_NOW)
-    {
-       	/* loop over the timer list */
-       	for (t = timer_head; t; lt = t, t = t->next)
-       	{
-       		if (t->expire!=TIME_NOW)
-       		{
-       			/* link the new guy in before the current list entry */
-       			timer->prev = t->prev;
-       			timer->next = t;
-       
-       			if (t->prev)
-       				t->prev->next = timer;
-       			else
-       				timer_head = timer;
-       			t->prev = timer;
-       			return;
-       		}
-       	}
-    }
-    else if (expire!=TIME_NEVER)
-    {
-       	/* loop over the timer list */
-       	for (t = timer_head; t; lt = t, t = t->next)
-       	{
-       		/* if the current list entry expires after us, we should be inserted before it */
-       		/* note that due to floating point rounding, we need to allow a bit of slop here */
-       		/* because two equal entries -- within rounding precision -- need to sort in */
-       		/* the order they were inserted into the list */
-       		//if ((t->expire - expire) > TIME_IN_NSEC(1))
-       		if (t->expire > expire)
-       		{
-       			/* link the new guy in before the current list entry */
-       			timer->prev = t->prev;
-       			timer->next = t;
-        
-       			if (t->prev)
-       				t->prev->next = timer;
-       			else
-       				timer_head = timer;
-       			t->prev = timer;
-       			return;
-       		}
-       	}
-    }
-    else
-    {
-       	/* loop over the timer list */
-       	for (t = timer_head; t; lt = t, t = t->next)
-       	{
-       	}
-    }
-    
-	/* need to insert after the last one */
-	if (lt)
-		lt->next = timer;
-	else
-		timer_head = timer;
-	timer->prev = lt;
-	timer->next = NULL;
+	/* disabled timers sort with the ones that never fire */
+	timer->key = timer->enabled ? timer->expire : TIME_NEVER;
+	timer->seq = timer_seq++;
+	timer_heap_up(timer_heap_count++, timer);
 }
 
 
 /*
- *		remove a timer from the linked list
+ *		remove a timer from the heap
  */
 INLINE void timer_list_remove(timer_entry *timer)
 {
-	/* remove it from the list */
-	if (timer->prev)
-		timer->prev->next = timer->next;
-	else
-		timer_head = timer->next;
-	if (timer->next)
-		timer->next->prev = timer->prev;
+	int i = timer->heap_index;
+	timer_entry *last = timer_heap[--timer_heap_count];
+
+	/* move the last entry into the hole and let it find its place */
+	if (last != timer)
+	{
+		if (i > 0 && timer_before(last, timer_heap[(i - 1) >> 1]))
+			timer_heap_up(i, last);
+		else
+			timer_heap_down(i, last);
+	}
 }
 
 
@@ -245,13 +272,15 @@ void timer_init(void)
 	memset(timers, 0, sizeof(timers));
 
 	/* initialize the lists */
-	timer_head = NULL;
+	timer_heap_count = 0;
+	timer_seq = 0;
 	timer_free_head = &timers[0];
 	for (i = 0; i < MAX_TIMERS-1; i++)
 		timers[i].next = &timers[i+1];
 
 	/* reset the CPU timers */
 	memset(cpudata, 0, sizeof(cpudata));
+	memset(deferred_count, 0, sizeof(deferred_count));
 	activecpu = NULL;
 	last_activecpu = lastcpu;
 
@@ -374,6 +403,10 @@ void *timer_set(timer_tm duration, int param, void (*callback)(int))
 	else timer->expire = time + duration;
 	timer_list_insert(timer);
 
+	/* a CPU asking for a TIME_NOW callback wants the others to catch up */
+	if (activecpu && duration==TIME_NOW)
+		sync_count++;
+
 	/* if we're supposed to fire before the end of this cycle, adjust the counter */
 	if (activecpu && timer->expire < base_time)
 		timer_adjust(timer, time, duration);
@@ -479,7 +512,11 @@ timer_tm timer_timeleft(void *which)
  */
 float timer_get_time(void)
 {
+#ifdef TIMER_64BIT
+	return (double)getabsolutetime()/(double)TIME_ONE_SEC;
+#else
 	return (float)global_offset + ((float)getabsolutetime()/(float)TIME_ONE_SEC);
+#endif
 }
 
 
@@ -543,44 +580,59 @@ int timer_schedule_cpu(int *cpu, int *cycles)
 
 
 /*
- *		end CPU execution by updating the number of cycles the CPU actually ran
+ *		end CPU execution by updating the number of cycles the CPU actually ran,
+ *		returns how many of them were cut off by timers set during the slice
  */
-void timer_update_cpu(int cpunum, int ran)
+int timer_update_cpu(int cpunum, int ran)
 {
 	cpu_entry *cpu = cpudata + cpunum;
+	int lost = 0;
 
 	/* update the time if we haven't been suspended */
 	if (!cpu->suspended)
 	{
-		cpu->time += (timer_tm)(ran - cpu->lost) * cpu->cycles_to_sec;
+		cpu->time += CYCLES_TO_TIME(ran - cpu->lost, cpu->cycles_to_sec);
+		lost = cpu->lost;
 		cpu->lost = 0;
 	}
 
+#ifndef TIMER_64BIT
 	/* time to renormalize? */
 	if (cpu->time >= TIME_ONE_SEC)
 	{
 		timer_entry *timer;
 		cpu_entry *c;
+		int i;
 
 		/* renormalize all the CPU timers */
 		for (c = cpudata; c <= lastcpu; c++)
 			c->time -= TIME_ONE_SEC;
 
-		/* renormalize all the timers' times */
-		for (timer = timer_head; timer; timer = timer->next)
+		/* renormalize all the timers' times, the shift keeps the heap in order */
+		for (i = 0; i < timer_heap_count; i++)
 		{
+			timer = timer_heap[i];
 			timer->start -= TIME_ONE_SEC;
 			if (timer->expire!=TIME_NEVER)
 			    timer->expire -= TIME_ONE_SEC;
+			if (timer->key!=TIME_NEVER)
+			    timer->key -= TIME_ONE_SEC;
 		}
 
+		/* and anything still waiting in the journals */
+		for (c = cpudata; c <= lastcpu; c++)
+			for (i = 0; i < deferred_count[c->index]; i++)
+				deferred[c->index][i].time -= TIME_ONE_SEC;
+
 		/* renormalize the global timers */
 		global_offset += 1;
 	}
+#endif
 
 	/* now stop counting cycles */
 	base_time = cpu->time;
 	activecpu = NULL;
+	return lost;
 }
 
 
@@ -710,6 +762,7 @@ void timer_trigger(int trigger)
 	if (activecpu)
 	{
 		int left = *activecpu->icount;
+		sync_count++;
 		if (left > 0)
 		{
 			activecpu->lost += left;
@@ -732,12 +785,113 @@ void timer_trigger(int trigger)
 }
 
 
+/*
+ *		queue callback(param) for a CPU at the current time, to be called
+ *		when that CPU has run up to it. Returns 0 if the caller has to fall
+ *		back to timer_set(TIME_NOW, ...)
+ */
+int timer_defer(int cpunum, void (*callback)(int), int param)
+{
+	cpu_entry *cpu = cpudata + cpunum;
+	deferred_event *ev = deferred[cpunum];
+	int i = deferred_count[cpunum];
+	timer_tm time;
+
+	/* only from another CPU's slice, and only to a CPU that will run again */
+	if (!activecpu || activecpu == cpu || cpu->suspended || i == MAX_DEFERRED)
+		return 0;
+
+	/* if it's already past this point, it needs the usual resync */
+	time = getabsolutetime();
+	if (time <= cpu->time)
+		return 0;
+
+	/* two writers can queue out of order; equal times stay in queue order */
+	for ( ; i > 0 && ev[i-1].time > time; i--)
+		ev[i] = ev[i-1];
+	ev[i].time = time;
+	ev[i].callback = callback;
+	ev[i].param = param;
+	deferred_count[cpunum]++;
+	return 1;
+}
+
+
+/*
+ *		call the journaled events of a CPU up to and including time upto
+ */
+static void deliver_deferred(cpu_entry *cpu, timer_tm upto)
+{
+	deferred_event *ev = deferred[cpu->index];
+	deferred_event e;
+
+	/* nobody is executing while these run */
+	activecpu = NULL;
+
+	while (deferred_count[cpu->index] && ev[0].time <= upto)
+	{
+		e = ev[0];
+		deferred_count[cpu->index]--;
+		memmove(ev, ev + 1, deferred_count[cpu->index] * sizeof(ev[0]));
+
+		/* run it as if a timer had fired at that time */
+		base_time = e.time;
+		(*e.callback)(e.param);
+	}
+}
+
+
+/*
+ *		deliver what a deferred CPU has reached and return where its next
+ *		slice has to stop
+ */
+static timer_tm deferred_limit(cpu_entry *cpu, timer_tm end)
+{
+	deferred_event *ev = deferred[cpu->index];
+	timer_tm limit;
+
+	for (;;)
+	{
+		deliver_deferred(cpu, cpu->time);
+
+		/* the callbacks may have started a timer that is due sooner */
+		limit = end;
+		if (timer_heap_count && timer_head->expire < limit)
+			limit = timer_head->expire;
+
+		if (!deferred_count[cpu->index] || ev[0].time >= limit)
+			return limit;
+		limit = ev[0].time;
+		if (CYCLES_CALC(limit - cpu->time, cpu->sec_to_cycles) > 0)
+			return limit;
+
+		/* less than a cycle away, so it's due now */
+		deliver_deferred(cpu, limit);
+	}
+}
+
+
+/*
+ *		number of times a running CPU has forced the others to resynchronize,
+ *		with a TIME_NOW timer or a trigger. Only differences mean anything.
+ */
+int timer_sync_count(void)
+{
+	return sync_count;
+}
+
+
 /*
  *		pick the next CPU to run
  */
 static int pick_cpu(int *cpunum, int *cycles, timer_tm end)
 {
-	cpu_entry *cpu = last_activecpu;
+	cpu_entry *cpu;
+	timer_tm limit;
+	int woke;
+
+retry:
+	cpu = last_activecpu;
 
 	/* look for a CPU that isn't suspended and hasn't run its full timeslice yet */
 	do
@@ -750,17 +904,26 @@ static int pick_cpu(int *cpunum, int *cycles, timer_tm end)
 		/* if this CPU isn't suspended and has time left.... */
 		if ((!cpu->suspended) && (cpu->time < end))
 		{
+			/* a deferred CPU stops at its journaled events */
+			limit = end;
+			if (deferred_count[cpu->index])
+			{
+				limit = deferred_limit(cpu, end);
+				if (cpu->suspended)
+					continue;
+			}
+
 			/* mark the CPU active, and remember the CPU number locally */
 			activecpu = last_activecpu = cpu;
 
 			/* return the number of cycles to execute and the CPU number */
 			*cpunum = cpu->index;
-			*cycles=CYCLES_CALC(end - cpu->time,cpu->sec_to_cycles);
+			*cycles=CYCLES_CALC(limit - cpu->time,cpu->sec_to_cycles);
 
 			if (*cycles > 0)
 			{
 				/* remember the base time for this CPU */
-				base_time = cpu->time + ((timer_tm)*cycles * cpu->cycles_to_sec);
+				base_time = cpu->time + CYCLES_TO_TIME(*cycles, cpu->cycles_to_sec);
 
 				/* success */
 				return 1;
@@ -769,6 +932,19 @@ static int pick_cpu(int *cpunum, int *cycles, timer_tm end)
 	}
 	while (cpu != last_activecpu);
 
+	/* a CPU that went to sleep before reaching its journaled events gets
+	   them now; if that wakes it up, it still has the rest of the slice */
+	woke = 0;
+	for (cpu = cpudata; cpu <= lastcpu; cpu++)
+		if (cpu->suspended && deferred_count[cpu->index] && deferred[cpu->index][0].time <= end)
+		{
+			deliver_deferred(cpu, end);
+			if (!cpu->suspended)
+				woke = 1;
+		}
+	if (woke)
+		goto retry;
+
 	/* ASG 990225 - bump all suspended CPU times after the slice has finished */
 	for (cpu = cpudata; cpu <= lastcpu; cpu++)
 		if (cpu->suspended && !cpu->nocount)
@@ -780,3 +956,175 @@ static int pick_cpu(int *cpunum, int *cycles, timer_tm end)
 	/* failure */
 	return 0;
 }
+
+
+/*
+ *		timer queue benchmark (-timerbench). Runs the same workload of
+ *		expiries and resets against the old sorted list and the heap with
+ *		1..MAX_TIMERS timers, checks both fire the timers in the same order
+ *		and reports the time each took. Must run before timer_init().
+ */
+#define BENCH_OPS 100000
+
+static timer_entry *bench_head;
+static timer_entry *bench_prev[MAX_TIMERS];
+
+static void bench_list_insert(timer_entry *timer)
+{
+	timer_entry *t, *lt = NULL;
+	timer_tm expire = timer->enabled ? timer->expire : TIME_NEVER;
+
+	/* the linear walk the scheduler used before the heap */
+	for (t = bench_head; t; lt = t, t = t->next)
+	{
+		if (expire != TIME_NEVER && t->expire > expire)
+		{
+			bench_prev[timer - timers] = bench_prev[t - timers];
+			timer->next = t;
+			if (bench_prev[t - timers])
+				bench_prev[t - timers]->next = timer;
+			else
+				bench_head = timer;
+			bench_prev[t - timers] = timer;
+			return;
+		}
+	}
+	if (lt)
+		lt->next = timer;
+	else
+		bench_head = timer;
+	bench_prev[timer - timers] = lt;
+	timer->next = NULL;
+}
+
+static void bench_list_remove(timer_entry *timer)
+{
+	timer_entry *prev = bench_prev[timer - timers];
+
+	if (prev)
+		prev->next = timer->next;
+	else
+		bench_head = timer->next;
+	if (timer->next)
+		bench_prev[timer->next - timers] = prev;
+}
+
+static int bench_run(int count, int use_heap, UINT8 *order)
+{
+	UINT32 rnd = 12345;
+	timer_tm now = 0;
+	int i, fired = 0;
+
+#define BENCH_RAND() (rnd = rnd * 1103515245 + 12345, (rnd >> 16) & 0x7fff)
+
+	memset(timers, 0, sizeof(timers));
+	timer_heap_count = 0;
+	timer_seq = 0;
+	bench_head = NULL;
+
+	for (i = 0; i < count; i++)
+	{
+		timer_entry *timer = &timers[i];
+
+		timer->enabled = 1;
+		/* a few idle timers, and coarse periods so that ties are common */
+		if ((BENCH_RAND() & 15) == 0)
+			timer->period = timer->expire = TIME_NEVER;
+		else
+			timer->expire = timer->period = ((BENCH_RAND() & 7) + 1) * 1024;
+		if (use_heap)
+			timer_list_insert(timer);
+		else
+			bench_list_insert(timer);
+	}
+
+	for (i = 0; i < BENCH_OPS; i++)
+	{
+		timer_entry *timer;
+
+		if (BENCH_RAND() & 3)
+		{
+			/* fire the next timer and reprime it */
+			timer = use_heap ? timer_heap[0] : bench_head;
+			if (timer->expire == TIME_NEVER)
+				break;
+			now = timer->expire;
+			timer->expire += timer->period;
+			order[fired++] = timer - timers;
+		}
+		else
+		{
+			/* reset a random timer, as a sound latch or CPU boost would */
+			timer = &timers[BENCH_RAND() % count];
+			if (timer->expire == TIME_NEVER)
+				continue;
+			timer->expire = now + (BENCH_RAND() & 7) * 1024;
+		}
+
+		if (use_heap)
+		{
+			timer_list_remove(timer);
+			timer_list_insert(timer);
+		}
+		else
+		{
+			bench_list_remove(timer);
+			bench_list_insert(timer);
+		}
+	}
+#undef BENCH_RAND
+
+	return fired;
+}
+
+void timer_queue_benchmark(void)
+{
+	static UINT8 order_list[BENCH_OPS], order_heap[BENCH_OPS];
+	static const int counts[] = { 8, 32, 128, MAX_TIMERS };
+	int i;
+
+	for (i = 0; i < sizeof(counts) / sizeof(counts[0]); i++)
+	{
+		unsigned int start, list_time, heap_time;
+		int list_fired, heap_fired;
+
+		start = osd_cycles();
+		list_fired = bench_run(counts[i], 0, order_list);
+		list_time = osd_cycles() - start;
+
+		start = osd_cycles();
+		heap_fired = bench_run(counts[i], 1, order_heap);
+		heap_time = osd_cycles() - start;
+
+		printf("timerbench: %3d timers  list %6u us  heap %6u us  order %s\n",
+			counts[i], list_time, heap_time,
+			(list_fired == heap_fired && !memcmp(order_list, order_heap, list_fired)) ? "same" : "DIFFERENT");
+	}
+
+	/* cost of the per-call conversions in the timebase this was built with, */
+	/* as done by getabsolutetime(), pick_cpu() and timer_update_cpu() */
+	{
+		volatile int icount = 1000;
+		timer_tm c2s = TIME_ONE_SEC / 4000000, s2c = 4000000;
+		timer_tm slice = TIME_IN_HZ(60 * 8), t = 0;
+		INT64 cycles = 0;
+		unsigned int start, elapsed;
+		int n;
+
+		start = osd_cycles();
+		for (n = 0; n < 1000000; n++)
+		{
+			t += slice - CYCLES_TO_TIME(icount + (n & 15), c2s);
+			cycles += CYCLES_CALC(slice - (t & 1023), s2c);
+		}
+		elapsed = osd_cycles() - start;
+
+		printf("timerbench: %d-bit timebase  %6u us per million conversions (%d)\n",
+			(int)sizeof(timer_tm) * 8, elapsed, (int)(cycles & 1));
+	}
+
+	/* leave the pool for timer_init() */
+	memset(timers, 0, sizeof(timers));
+	timer_heap_count = 0;
+	bench_head = NULL;
+}
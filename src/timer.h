@@ -10,10 +10,33 @@
 #ifndef __TIMER_H__
 #define __TIMER_H__
 
-typedef INT32 timer_tm;
+#ifdef TIMER_64BIT
 
-extern timer_tm cycles_to_sec[];
-extern timer_tm sec_to_cycles[];
+/* 64-bit timebase, 2^40 ticks per second. Absolute time doesn't wrap for
+   about 97 days, so there is no once-a-second renormalisation and the
+   per-cycle time of even a 50MHz CPU is exact to a few parts per million */
+typedef INT64 timer_tm;
+
+#define TIME_NOW              (0)
+#define TIME_NEVER            ((timer_tm)0x7fffffffffffffffLL)
+
+#define TIME_ONE_SEC          ((timer_tm)1<<40)
+#define TIME_IN_HZ(hz)        (TIME_ONE_SEC / ((timer_tm)(hz)))
+#define TIME_IN_CYCLES(c,cpu) ((timer_tm)(c) * cycles_to_sec[(cpu)])
+#define TIME_IN_SEC(s)        ((timer_tm)((s) * (double)(TIME_ONE_SEC)))
+#define TIME_IN_MSEC(ms)      ((timer_tm)(((double)(ms)*(double)(TIME_ONE_SEC))/(double)1000))
+#define TIME_IN_USEC(us)      ((timer_tm)(((double)(us)*(double)(TIME_ONE_SEC))/(double)1000000))
+#define TIME_IN_NSEC(ns)      ((timer_tm)(((double)(ns)*(double)(TIME_ONE_SEC))/(double)1000000000))
+
+/* t*cycles would overflow 64 bits, so drop 8 bits of t (far below one
+   cycle of any emulated CPU) and clamp to 8s, past which only TIME_NEVER
+   gets here */
+#define CYCLES_CLAMP(t)       ((t) > 8*TIME_ONE_SEC ? 8*TIME_ONE_SEC : (t) < -8*TIME_ONE_SEC ? -8*TIME_ONE_SEC : (t))
+#define CYCLES_CALC(t,cycles) (((((INT64)CYCLES_CLAMP((timer_tm)(t)))>>8)*((INT64)(cycles)))/((INT64)1<<32))
+
+#else
+
+typedef INT32 timer_tm;
 
 #define TIME_NOW              (0)
 #define TIME_NEVER            (2147483647)
@@ -39,6 +62,12 @@ extern timer_tm sec_to_cycles[];
 #define TIME_IN_NSEC(ns)      (((INT64)(ns)*(INT64)(TIME_ONE_SEC))/(INT64)1000000000)
 
 #define CYCLES_CALC(t,cycles) ((((INT64)(t))*((INT64)(cycles)))/((INT64)TIME_ONE_SEC))
+
+#endif
+
+extern timer_tm cycles_to_sec[];
+extern timer_tm sec_to_cycles[];
+
 #define TIME_TO_CYCLES(cpu,t) CYCLES_CALC((t),sec_to_cycles[(cpu)])
 
 #define SUSPEND_REASON_HALT		0x0001
@@ -58,7 +87,7 @@ timer_tm timer_timeelapsed(void *which);
 timer_tm timer_timeleft(void *which);
 float timer_get_time(void);
 int timer_schedule_cpu(int *cpu, int *cycles);
-void timer_update_cpu(int cpu, int ran);
+int timer_update_cpu(int cpu, int ran);
 void timer_suspendcpu(int cpu, int suspend, int reason);
 void timer_holdcpu(int cpu, int hold, int reason);
 int timer_iscpususpended(int cpu, int reason);
@@ -66,14 +95,19 @@ int timer_iscpuheld(int cpunum, int reason);
 void timer_suspendcpu_trigger(int cpu, int trigger);
 void timer_holdcpu_trigger(int cpu, int trigger);
 void timer_trigger(int trigger);
+int timer_defer(int cpunum, void (*callback)(int), int param);
+int timer_sync_count(void);
 float timer_get_overclock(int cpunum);
 void timer_set_overclock(int cpunum, float overclock);
 
 timer_tm getabsolutetime(void);
+void timer_queue_benchmark(void);
 typedef struct timer_entry
 {
-	struct timer_entry *next;
-	struct timer_entry *prev;
+	struct timer_entry *next;	/* free list link */
+	int heap_index;			/* slot in the active timer heap */
+	UINT32 seq;			/* insertion order, breaks ties on equal keys */
+	timer_tm key;			/* expire, or TIME_NEVER while disabled */
 	void (*callback)(int);
 	int callback_param;
 	int enabled;
@@ -276,6 +276,11 @@ ZIP* openzip(const char* zipfile) {
 	/* reset ent */
 	zip->ent.name = 0;
 
+	/* no index yet */
+	zip->name_index = 0;
+	zip->crc_index = 0;
+	zip->index_mask = 0;
+
 	/* rewind */
 	zip->cd_pos = 0;
 
@@ -355,6 +360,8 @@ struct zipent* readzip(ZIP* zip) {
 void closezip(ZIP* zip) {
 	/* release all */
 	free(zip->ent.name);
+	free(zip->name_index);
+	free(zip->crc_index);
 	free(zip->cd);
 	free(zip->ecd);
 	/* only if not suspended */
@@ -406,6 +413,164 @@ void rewindzip(ZIP* zip) {
 	zip->cd_pos = 0;
 }
 
+/* -------------------------------------------------------------------------
+   Central directory index
+ ------------------------------------------------------------------------- */
+
+/* Hash a file name the way equal_filename() compares them: the part after
+   the last '/', case ignored */
+static unsigned hash_filename(const char* name, unsigned len) {
+	unsigned h = 2166136261u;
+	unsigned i;
+
+	for (i = len; i > 0; --i)
+		if (name[i-1] == '/')
+			break;
+	for (; i < len; ++i)
+		h = (h ^ (unsigned char)toupper(name[i])) * 16777619u;
+	return h;
+}
+
+static unsigned hash_crc(UINT32 crc) {
+	return crc * 2654435761u;
+}
+
+/* Entries are inserted in directory order with linear probing, so of two
+   entries with the same key a lookup meets the first one first, as a
+   readzip() scan would */
+static int zip_build_index(ZIP* zip) {
+	unsigned size = 16;
+	unsigned pos;
+
+	while (size < 2u * zip->total_entries_cent_dir)
+		size <<= 1;
+
+	zip->name_index = (unsigned*)calloc(size, sizeof(unsigned));
+	zip->crc_index = (unsigned*)calloc(size, sizeof(unsigned));
+	if (!zip->name_index || !zip->crc_index) {
+		free(zip->name_index);
+		free(zip->crc_index);
+		zip->name_index = zip->crc_index = 0;
+		return -1;
+	}
+	zip->index_mask = size - 1;
+
+	for (pos = 0; pos + ZIPCFN <= zip->size_of_cent_dir; ) {
+		UINT16 filename_length = read_word (zip->cd+pos+ZIPCFNL);
+		unsigned slot;
+
+		/* readzip() stops here too */
+		if (pos + ZIPCFN + filename_length > zip->size_of_cent_dir)
+			break;
+
+		slot = hash_filename(zip->cd+pos+ZIPCFN, filename_length) & zip->index_mask;
+		while (zip->name_index[slot])
+			slot = (slot + 1) & zip->index_mask;
+		zip->name_index[slot] = pos + 1;
+
+		slot = hash_crc(read_dword (zip->cd+pos+ZIPCCRC)) & zip->index_mask;
+		while (zip->crc_index[slot])
+			slot = (slot + 1) & zip->index_mask;
+		zip->crc_index[slot] = pos + 1;
+
+		pos += ZIPCFN + filename_length + read_word (zip->cd+pos+ZIPCXTL) + read_word (zip->cd+pos+ZIPCCML);
+	}
+
+	return 0;
+}
+
+static int equal_filename(const char* zipfile, const char* file);
+
+/* Central directory offset of the first entry named name, or -1 */
+static int zip_lookup_name(ZIP* zip, const char* name) {
+	unsigned slot;
+
+	if (!zip->name_index && zip_build_index(zip) != 0) {
+		/* no memory for the index, scan */
+		rewindzip(zip);
+		for (;;) {
+			unsigned pos = zip->cd_pos;
+			if (!readzip(zip))
+				return -1;
+			if (equal_filename(zip->ent.name, name))
+				return pos;
+		}
+	}
+
+	for (slot = hash_filename(name, strlen(name)) & zip->index_mask; zip->name_index[slot]; slot = (slot + 1) & zip->index_mask) {
+		zip->cd_pos = zip->name_index[slot] - 1;
+		if (readzip(zip) && equal_filename(zip->ent.name, name))
+			return zip->name_index[slot] - 1;
+	}
+	return -1;
+}
+
+/* Central directory offset of the first entry with this CRC, or -1 */
+static int zip_lookup_crc(ZIP* zip, UINT32 crc) {
+	unsigned slot;
+
+	if (!zip->crc_index && zip_build_index(zip) != 0) {
+		rewindzip(zip);
+		for (;;) {
+			unsigned pos = zip->cd_pos;
+			if (!readzip(zip))
+				return -1;
+			if (zip->ent.crc32 == crc)
+				return pos;
+		}
+	}
+
+	for (slot = hash_crc(crc) & zip->index_mask; zip->crc_index[slot]; slot = (slot + 1) & zip->index_mask) {
+		if (read_dword (zip->cd+zip->crc_index[slot]-1+ZIPCCRC) == crc)
+			return zip->crc_index[slot] - 1;
+	}
+	return -1;
+}
+
+static struct zipent* zip_read_at(ZIP* zip, int pos) {
+	if (pos < 0)
+		return 0;
+	zip->cd_pos = pos;
+	return readzip(zip);
+}
+
+/* Finds an entry by name (case and directory ignored) or by CRC
+   return:
+     !=0 the entry, valid until the next call on zip
+     ==0 not found
+   note:
+     Lookups go through the hash index, so they don't depend on the number
+     of entries. They move the readzip() position.
+*/
+static struct zipent* zip_find_name(ZIP* zip, const char* name) {
+	return zip_read_at(zip, zip_lookup_name(zip, name));
+}
+
+static struct zipent* zip_find_crc(ZIP* zip, UINT32 crc) {
+	return zip_read_at(zip, zip_lookup_crc(zip, crc));
+}
+
+/* The entry a ROM called filename is loaded from: the one of that name or,
+   NS981003 "load by CRC", one whose CRC prints as filename, whichever comes
+   first in the zip */
+static struct zipent* zip_find_rom(ZIP* zip, const char* filename) {
+	int pos = zip_lookup_name(zip, filename);
+	int i;
+
+	for (i = 0; i < 8; ++i)
+		if (!isdigit(filename[i]) && (filename[i] < 'a' || filename[i] > 'f'))
+			break;
+	if (i == 8 && filename[8] == 0) {
+		UINT32 crc = strtoul(filename, 0, 16);
+		int crcpos = crc ? zip_lookup_crc(zip, crc) : -1;
+
+		if (crcpos >= 0 && (pos < 0 || crcpos < pos))
+			pos = crcpos;
+	}
+
+	return zip_read_at(zip, pos);
+}
+
 /* Seek zip->fp to compressed data
    return:
 	==0 success
@@ -459,7 +624,7 @@ int seekcompresszip(ZIP* zip, struct zipent* ent) {
 
    990525 rewritten for use with zlib MLR
 */
-static int inflate_file(FILE* in_file, unsigned in_size, unsigned char* out_data, unsigned out_size)
+static int inflate_file(FILE* in_file, unsigned in_size, unsigned char* out_data, unsigned out_size, unsigned int* crc)
 {
     int err;
 	unsigned char* in_buffer;
@@ -505,6 +670,14 @@ static int inflate_file(FILE* in_file, unsigned in_size, unsigned char* out_data
 			d_stream.avail_in++; /* add dummy byte at end of compressed data */
 
         err = inflate(&d_stream, Z_NO_FLUSH);
+
+		/* checksum what was just inflated while it is still in the cache */
+		if (crc)
+		{
+			*crc = crc32(*crc, out_data, d_stream.next_out - out_data);
+			out_data = d_stream.next_out;
+		}
+
         if (err == Z_STREAM_END)
 			break;
 		if (err != Z_OK)
@@ -595,7 +768,7 @@ int readuncompresszip(ZIP* zip, struct zipent* ent, char* data) {
 		}
 
 		/* configure inflate */
-		if (inflate_file( zip->fp, ent->compressed_size, (unsigned char*)data, ent->uncompressed_size))
+		if (inflate_file( zip->fp, ent->compressed_size, (unsigned char*)data, ent->uncompressed_size, 0))
 		{
 			errormsg("Inflating compressed data", ERROR_CORRUPT, zip->zip);
 			return -3;
@@ -613,12 +786,13 @@ int readuncompresszip(ZIP* zip, struct zipent* ent, char* data) {
  ------------------------------------------------------------------------- */
 
 /* Use the zip cache */
-//#define ZIP_CACHE
+#define ZIP_CACHE
 
 #ifdef ZIP_CACHE
 
-/* ZIP cache entries */
-#define ZIP_CACHE_MAX 2
+/* ZIP cache entries: a Neo Geo clone loads from itself, its parent and
+   neogeo.zip, one more keeps the three from evicting each other */
+#define ZIP_CACHE_MAX 4
 
 /* ZIP cache buffer LRU ( Last Recently Used )
      zip_cache_map[0] is the newer
@@ -667,6 +841,10 @@ static ZIP* cache_openzip(const char* zipfile) {
 	if (!zip)
 		return 0;
 
+	/* index it now, every ROM of the set is looked up in it; without
+	   memory the lookups scan */
+	zip_build_index(zip);
+
 	/* close the oldest entry */
 	if (zip_cache_map[ZIP_CACHE_MAX-1]) {
 		/* close last zip */
@@ -772,38 +950,29 @@ int /* error */ load_zipped_file (const char* zipfile, const char* filename, uns
 	if (!zip)
 		return -1;
 
-	while (readzip(zip)) {
-		/* NS981003: support for "load by CRC" */
-		char crc[9];
-
-		ent = &(zip->ent);
-
-		sprintf(crc,"%08x",ent->crc32);
-		if (equal_filename(ent->name, filename) ||
-				(ent->crc32 && !strcmp(crc, filename)))
-		{
-			*length = ent->uncompressed_size;
-			*buf = (unsigned char*)malloc( *length );
-			if (!*buf) {
-				if (!gUnzipQuiet)
-					printf("load_zipped_file(): Unable to allocate %d bytes of RAM\n",*length);
-				cache_closezip(zip);
-				return -1;
-			}
+	ent = zip_find_rom(zip, filename);
+	if (!ent) {
+		cache_suspendzip(zip);
+		return -1;
+	}
 
-			if (readuncompresszip(zip, ent, (char*)*buf)!=0) {
-				free(*buf);
-				cache_closezip(zip);
-				return -1;
-			}
+	*length = ent->uncompressed_size;
+	*buf = (unsigned char*)malloc( *length );
+	if (!*buf) {
+		if (!gUnzipQuiet)
+			printf("load_zipped_file(): Unable to allocate %d bytes of RAM\n",*length);
+		cache_closezip(zip);
+		return -1;
+	}
 
-			cache_suspendzip(zip);
-			return 0;
-		}
+	if (readuncompresszip(zip, ent, (char*)*buf)!=0) {
+		free(*buf);
+		cache_closezip(zip);
+		return -1;
 	}
 
 	cache_suspendzip(zip);
-	return -1;
+	return 0;
 }
 
 /*	Pass the path to the zipfile and the name of the file within the zipfile.
@@ -817,37 +986,102 @@ int /* error */ checksum_zipped_file (const char *zipfile, const char *filename,
 	if (!zip)
 		return -1;
 
-	while (readzip(zip)) {
-		ent = &(zip->ent);
+	ent = zip_find_name(zip, filename);
 
-		if (equal_filename(ent->name, filename))
-		{
-			*length = ent->uncompressed_size;
-			*sum = ent->crc32;
-			cache_suspendzip(zip);
-			return 0;
-		}
+	/* NS981003: support for "load by CRC" */
+	if (!ent && *sum)
+		ent = zip_find_crc(zip, *sum);
+
+	if (ent) {
+		*length = ent->uncompressed_size;
+		*sum = ent->crc32;
+		cache_suspendzip(zip);
+		return 0;
 	}
 
 	cache_suspendzip(zip);
+	return -1;
+}
+
+/* Like load_zipped_file(), but only finds the entry; read_zipped_entry()
+   reads it later. ent->name is cleared, it points into the closed zip. */
+int /* error */ locate_zipped_file (const char* zipfile, const char* filename, struct zipent* ent) {
+	ZIP* zip;
+	struct zipent* found;
+	int err = -1;
 
-	/* NS981003: support for "load by CRC" */
 	zip = cache_openzip(zipfile);
 	if (!zip)
 		return -1;
 
-	while (readzip(zip)) {
-		ent = &(zip->ent);
+	found = zip_find_rom(zip, filename);
 
-		if (*sum && ent->crc32 == *sum)
-		{
-			*length = ent->uncompressed_size;
-			*sum = ent->crc32;
-			cache_suspendzip(zip);
-			return 0;
-		}
+	/* same checks as readuncompresszip(), while the zip is at hand */
+	if (!found)
+		;
+	else if (found->compression_method == 0x0000) {
+		if (found->compressed_size != found->uncompressed_size)
+			errormsg("Wrong uncompressed size in store compression", ERROR_CORRUPT,zip->zip);
+		else
+			err = 0;
+	} else if (found->compression_method == 0x0008) {
+		if (found->version_needed_to_extract > 0x14)
+			errormsg("Version too new", ERROR_UNSUPPORTED,zip->zip);
+		else if (found->os_needed_to_extract != 0x00)
+			errormsg("OS not supported", ERROR_UNSUPPORTED,zip->zip);
+		else if (found->disk_number_start != zip->number_of_this_disk)
+			errormsg("Cannot span disks", ERROR_UNSUPPORTED,zip->zip);
+		else
+			err = 0;
+	} else
+		errormsg("Compression method unsupported", ERROR_UNSUPPORTED, zip->zip);
+
+	if (err == 0) {
+		*ent = *found;
+		ent->name = 0;
 	}
 
 	cache_suspendzip(zip);
-	return -1;
+	return err;
+}
+
+/* Read an entry found by locate_zipped_file() into data (uncompressed_size
+   bytes) and set crc to its CRC-32, computed as the data comes in. Opens its
+   own handle on the zip, so several entries can be read at once from
+   different threads. */
+int /* error */ read_zipped_entry (const char* zipfile, const struct zipent* ent, unsigned char* data, unsigned int* crc) {
+	ZIP zip;
+	int err = 0;
+
+	memset(&zip, 0, sizeof(zip));
+	zip.zip = (char*)zipfile;
+	zip.fp = fopen(zipfile, "rb");
+	if (!zip.fp) {
+		errormsg ("Opening for reading", ERROR_FILESYSTEM, zipfile);
+		return -1;
+	}
+
+	*crc = 0;
+	if (seekcompresszip(&zip, (struct zipent*)ent) != 0)
+		err = -1;
+	else if (ent->compression_method == 0x0000) {
+		unsigned done = 0;
+
+		while (done < ent->uncompressed_size) {
+			unsigned n = MIN(ent->uncompressed_size - done, INFLATE_INPUT_BUFFER_MAX);
+			if (fread(data + done, n, 1, zip.fp) != 1) {
+				errormsg ("Reading compressed data", ERROR_CORRUPT, zipfile);
+				err = -1;
+				break;
+			}
+			*crc = crc32(*crc, data + done, n);
+			done += n;
+		}
+	} else if (inflate_file(zip.fp, ent->compressed_size, data, ent->uncompressed_size, crc)) {
+		errormsg("Inflating compressed data", ERROR_CORRUPT, zipfile);
+		err = -3;
+	}
+
+	fclose(zip.fp);
+	return err;
 }
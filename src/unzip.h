@@ -55,6 +55,11 @@ typedef struct _ZIP {
 	UINT32	offset_to_start_of_cent_dir;
 	UINT16	zipfile_comment_length;
 	char*	zipfile_comment; /* pointer in ecd */
+
+	/* central directory hash index, built when the zip enters the cache or on the first lookup */
+	unsigned* name_index; /* cd offset+1 of the entries, by upper-cased name without path; 0 = free */
+	unsigned* crc_index; /* same, by CRC */
+	unsigned index_mask;
 } ZIP;
 
 /* Opens a zip stream for reading
@@ -121,6 +126,8 @@ int readuncompresszip(ZIP* zip, struct zipent* ent, char* data);
 int /* error */ load_zipped_file (const char *zipfile, const char *filename,
 	unsigned char **buf, unsigned int *length);
 int /* error */ checksum_zipped_file (const char *zipfile, const char *filename, unsigned int *length, unsigned int *sum);
+int /* error */ locate_zipped_file (const char *zipfile, const char *filename, struct zipent *ent);
+int /* error */ read_zipped_entry (const char *zipfile, const struct zipent *ent, unsigned char *data, unsigned int *crc);
 
 void unzip_cache_clear(void);
 
@@ -91,8 +91,12 @@ int screen_yoffs = 0;
 
 /******************************************************************************/
 
+static void decode_end(void);
+
 void neogeo_vh_stop(void)
 {
+	decode_end();
+
    	if (pal_bank1) free(pal_bank1);
 	if (pal_bank2) free(pal_bank2);
 	if (vidram) free(vidram);
@@ -163,12 +167,42 @@ static UINT32 *get_tile (int tileno)
     return gfxdata;
 }
 
-static void decodetile(int tileno)
+/* pen_usage doubles as the state of a sprite tile: 0 while it is still in
+   ROM format, TILE_BUSY while some thread decodes it in place, then the pens
+   it uses. The tile data is written before the release store of its
+   pen_usage, so whoever reads the pens with acquire can draw the tile */
+#define TILE_BUSY	0x80000000
+
+/* byte of one bitplane -> that bit of each of the 8 pens of a row */
+static UINT32 decode_spread[256];
+
+static void decode_init(void)
+{
+	int b,x;
+
+	for (b = 0;b < 256;b++)
+	{
+		decode_spread[b] = 0;
+		for (x = 0;x < 8;x++)
+			decode_spread[b] |= ((b >> x) & 1) << 4*(7-x);
+	}
+}
+
+static unsigned int decodetile(int tileno)
 {
+	unsigned int *pen_usage = &Machine->gfx[2]->pen_usage[tileno];
 	unsigned char swap[128];
 	UINT32 *gfxdata;
+	unsigned int usage = 0, expected = 0;
 	int x,y;
-	unsigned int pen;
+
+	if (!__atomic_compare_exchange_n(pen_usage,&expected,TILE_BUSY,0,__ATOMIC_ACQUIRE,__ATOMIC_ACQUIRE))
+	{
+		/* the other thread got there first; it takes well under a microsecond */
+		while (expected == TILE_BUSY)
+			expected = __atomic_load_n(pen_usage,__ATOMIC_ACQUIRE);
+		return expected;
+	}
 
     gfxdata=get_tile (tileno);
 
@@ -176,31 +210,107 @@ static void decodetile(int tileno)
 
 	for (y = 0;y < 16;y++)
 	{
-		UINT32 dw;
+		const unsigned char *p0 = &swap[64 + 4*y];
+		const unsigned char *p1 = &swap[4*y];
+		UINT32 dw0, dw1;
+
+		dw0 = (decode_spread[p0[3]] << 3) | (decode_spread[p0[1]] << 2) |
+			(decode_spread[p0[2]] << 1) | decode_spread[p0[0]];
+		dw1 = (decode_spread[p1[3]] << 3) | (decode_spread[p1[1]] << 2) |
+			(decode_spread[p1[2]] << 1) | decode_spread[p1[0]];
+		for (x = 0;x < 32;x += 4)
+			usage |= (1 << ((dw0 >> x) & 15)) | (1 << ((dw1 >> x) & 15));
+		*(gfxdata++) = dw0;
+		*(gfxdata++) = dw1;
+	}
 
-		dw = 0;
-		for (x = 0;x < 8;x++)
+	__atomic_store_n(pen_usage,usage,__ATOMIC_RELEASE);
+	return usage;
+}
+
+/* background decoding (-neoprefetch). The sprite ROM is walked in banks of
+   256 tiles; a bank the game has just started drawing from goes first,
+   since its neighbours are usually the next frames of the same animation */
+int neogeo_prefetch = 0;
+
+#define DECODE_BANK_SHIFT	8
+
+static UINT8 *bank_wanted;	/* set by the emulation thread on a miss */
+static UINT8 *bank_done;	/* decoder only */
+static int decode_banks;
+static volatile int decode_stop;
+
+INLINE unsigned int tile_pen_usage(int tileno)
+{
+	unsigned int usage = __atomic_load_n(&Machine->gfx[2]->pen_usage[tileno],__ATOMIC_ACQUIRE);
+
+	if (usage == 0 || usage == TILE_BUSY)
+	{
+		if (bank_wanted)
+			bank_wanted[tileno >> DECODE_BANK_SHIFT] = 1;
+		usage = decodetile(tileno);
+	}
+	return usage;
+}
+
+static void decode_thread(void *param)
+{
+	unsigned int *pen_usage = Machine->gfx[2]->pen_usage;
+	int next = 0, decoded = 0;
+
+	while (!decode_stop)
+	{
+		int bank, tileno, end;
+
+		for (bank = 0;bank < decode_banks;bank++)
+			if (bank_wanted[bank] && !bank_done[bank]) break;
+		if (bank == decode_banks)
 		{
-			pen  = ((swap[64 + 4*y + 3] >> x) & 1) << 3;
-			pen |= ((swap[64 + 4*y + 1] >> x) & 1) << 2;
-			pen |= ((swap[64 + 4*y + 2] >> x) & 1) << 1;
-			pen |=  (swap[64 + 4*y    ] >> x) & 1;
-			dw |= pen << 4*(7-x);
-			Machine->gfx[2]->pen_usage[tileno] |= (1 << pen);
+			while (next < decode_banks && bank_done[next]) next++;
+			if (next == decode_banks) break;
+			bank = next;
 		}
-		*(gfxdata++) = dw;
+		bank_done[bank] = 1;
 
-		dw = 0;
-		for (x = 0;x < 8;x++)
+		tileno = bank << DECODE_BANK_SHIFT;
+		end = tileno + (1 << DECODE_BANK_SHIFT);
+		if (end > no_of_tiles) end = no_of_tiles;
+		for (;tileno < end;tileno++)
 		{
-			pen  = ((swap[4*y + 3] >> x) & 1) << 3;
-			pen |= ((swap[4*y + 1] >> x) & 1) << 2;
-			pen |= ((swap[4*y + 2] >> x) & 1) << 1;
-			pen |=  (swap[4*y    ] >> x) & 1;
-			dw |= pen << 4*(7-x);
-			Machine->gfx[2]->pen_usage[tileno] |= (1 << pen);
+			if (__atomic_load_n(&pen_usage[tileno],__ATOMIC_RELAXED) == 0)
+			{
+				decodetile(tileno);
+				decoded++;
+			}
 		}
-		*(gfxdata++) = dw;
+	}
+	logerror("neogeo: %d sprite tiles decoded in the background%s\n",decoded,decode_stop ? " (stopped)" : "");
+}
+
+static void decode_start(void)
+{
+	decode_banks = (no_of_tiles + (1 << DECODE_BANK_SHIFT) - 1) >> DECODE_BANK_SHIFT;
+	bank_wanted = (UINT8 *)calloc(decode_banks,1);
+	bank_done = (UINT8 *)calloc(decode_banks,1);
+	decode_stop = 0;
+	if (!bank_wanted || !bank_done || !osd_background_start(decode_thread,0))
+	{
+		/* tiles still get decoded as they are drawn */
+		free(bank_wanted);
+		free(bank_done);
+		bank_wanted = bank_done = 0;
+	}
+}
+
+static void decode_end(void)
+{
+	if (bank_done)
+	{
+		decode_stop = 1;
+		osd_background_wait();
+		free(bank_wanted);
+		free(bank_done);
+		bank_wanted = bank_done = 0;
 	}
 }
 
@@ -216,11 +326,17 @@ int neogeo_mvs_vh_start(void)
 	Machine->gfx[2]->pen_usage = (unsigned int*)malloc(no_of_tiles * sizeof(int));
 	memset(Machine->gfx[2]->pen_usage,0,no_of_tiles * sizeof(int));
 
-	/* tiles are not decoded yet. They will be decoded later as they are used. */
+	/* tiles are not decoded yet. They will be decoded later as they are used, */
+	/* or ahead of that by decode_thread(). */
 	/* pen_usage is used as a marker of decoded tiles: if it is 0, then the tile */
 	/* hasn't been decoded yet. */
+	decode_init();
 
-	return common_vh_start();
+	if (common_vh_start())
+		return 1;
+	if (neogeo_prefetch)
+		decode_start();
+	return 0;
 }
 
 /******************************************************************************/
@@ -332,7 +448,6 @@ static const unsigned char *neogeo_palette(const struct rectangle *clip)
 	}
 
 	/* Tiles */
-	pen_usage= Machine->gfx[2]->pen_usage;
 	pal_base = Machine->drv->gfxdecodeinfo[2].color_codes_start;
 	for (color = 0;color < 256;color++) colmask[color] = 0;
 	for (count=0;count<0x300;count+=2) {
@@ -452,9 +567,7 @@ static const unsigned char *neogeo_palette(const struct rectangle *clip)
 			{
 				tileatr=tileatr>>8;
 				tileno %= no_of_tiles;
-				if (pen_usage[tileno] == 0)	/* decode tile if it hasn't been yet */
-					decodetile(tileno);
-				colmask[tileatr] |= pen_usage[tileno];
+				colmask[tileatr] |= tile_pen_usage(tileno);	/* decodes the tile if it hasn't been yet */
 			}
 
 			sy +=yskip;
@@ -558,11 +671,9 @@ void NeoMVSDrawGfx(unsigned char **line,const struct GfxElement *gfx, /* AJP */
 	/* Safety feature */
 	code=code%no_of_tiles;
 
-	if (gfx->pen_usage[code] == 0)	/* decode tile if it hasn't been yet */
-		decodetile(code);
-
-	/* Check for total transparency, no need to draw */
-	if ((gfx->pen_usage[code] & ~1) == 0)
+	/* Check for total transparency, no need to draw. Decodes the tile */
+	/* if it hasn't been yet */
+	if ((tile_pen_usage(code) & ~1) == 0)
 		return;
 
    	if(zy==16)
@@ -745,11 +856,9 @@ void NeoMVSDrawGfx16(unsigned char **line,const struct GfxElement *gfx, /* AJP *
 	/* Safety feature */
 	code=code%no_of_tiles;
 
-	if (gfx->pen_usage[code] == 0)	/* decode tile if it hasn't been yet */
-		decodetile(code);
-
-	/* Check for total transparency, no need to draw */
-	if ((gfx->pen_usage[code] & ~1) == 0)
+	/* Check for total transparency, no need to draw. Decodes the tile */
+	/* if it hasn't been yet */
+	if ((tile_pen_usage(code) & ~1) == 0)
 		return;
 
    	if(zy==16)